@@ -0,0 +1,219 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/equal.h>
+#include <thrust/find.h>
+#include <thrust/histogram.h>
+#include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/sparse.h>
+#include <thrust/transform.h>
+
+#include "bench.hpp"
+
+namespace {
+
+void transform(benchmark::State& state) {
+  std::size_t n = state.range(0);
+  auto x = bench::random_device_vector<int>(n, 100);
+  auto y = bench::device_vector<int>(n);
+
+  for (auto _ : state) {
+    thrust::transform(bench::policy(), x.begin(), x.end(), y.begin(),
+                      [](int v) { return 2 * v + 1; });
+  }
+  bench::set_bytes(state, 2 * n * sizeof(int));
+}
+BENCHMARK(transform)->Apply(bench::element_counts);
+
+void reduce(benchmark::State& state) {
+  std::size_t n = state.range(0);
+  auto x = bench::random_device_vector<int>(n, 100);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(thrust::reduce(bench::policy(), x.begin(),
+                                            x.end()));
+  }
+  bench::set_bytes(state, n * sizeof(int));
+}
+BENCHMARK(reduce)->Apply(bench::element_counts);
+
+void reduce_by_key(benchmark::State& state) {
+  std::size_t n = state.range(0);
+  auto keys = bench::random_device_vector<int>(n, 1000);
+  auto values = bench::random_device_vector<int>(n, 100);
+  thrust::stable_sort(bench::policy(), keys.begin(), keys.end());
+  auto keys_out = bench::device_vector<int>(n);
+  auto values_out = bench::device_vector<int>(n);
+
+  for (auto _ : state) {
+    thrust::reduce_by_key(bench::policy(), keys.begin(), keys.end(),
+                          values.begin(), keys_out.begin(),
+                          values_out.begin());
+  }
+  bench::set_bytes(state, 2 * n * sizeof(int));
+}
+BENCHMARK(reduce_by_key)->Apply(bench::element_counts);
+
+void inclusive_scan(benchmark::State& state) {
+  std::size_t n = state.range(0);
+  auto x = bench::random_device_vector<int>(n, 100);
+  auto y = bench::device_vector<int>(n);
+
+  for (auto _ : state) {
+    thrust::inclusive_scan(bench::policy(), x.begin(), x.end(), y.begin());
+  }
+  bench::set_bytes(state, 2 * n * sizeof(int));
+}
+BENCHMARK(inclusive_scan)->Apply(bench::element_counts);
+
+void copy_if(benchmark::State& state) {
+  std::size_t n = state.range(0);
+  auto x = bench::random_device_vector<int>(n, 100);
+  auto y = bench::device_vector<int>(n);
+
+  for (auto _ : state) {
+    thrust::copy_if(bench::policy(), x.begin(), x.end(), y.begin(),
+                    [](int v) { return v % 2 == 0; });
+  }
+  bench::set_bytes(state, n * sizeof(int));
+}
+BENCHMARK(copy_if)->Apply(bench::element_counts);
+
+void sort(benchmark::State& state) {
+  std::size_t n = state.range(0);
+  auto keys = bench::random_device_vector<int>(n, 1 << 30);
+  auto x = bench::device_vector<int>(n);
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    thrust::copy(bench::policy(), keys.begin(), keys.end(), x.begin());
+    state.ResumeTiming();
+    thrust::sort(bench::policy(), x.begin(), x.end());
+  }
+  bench::set_bytes(state, n * sizeof(int));
+}
+BENCHMARK(sort)->Apply(bench::element_counts);
+
+// Searches with no match, which have to examine the whole range.
+void find_if(benchmark::State& state) {
+  std::size_t n = state.range(0);
+  auto x = bench::random_device_vector<int>(n, 100);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(thrust::find_if(bench::policy(), x.begin(),
+                                             x.end(),
+                                             [](int v) { return v < 0; }));
+  }
+  bench::set_bytes(state, n * sizeof(int));
+}
+BENCHMARK(find_if)->Apply(bench::element_counts);
+
+void equal_host_device(benchmark::State& state) {
+  std::size_t n = state.range(0);
+  std::vector<int> v = bench::random_values<int>(n, 100);
+  auto d_v = bench::device_vector<int>(n);
+  thrust::copy(bench::policy(), v.begin(), v.end(), d_v.begin());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        thrust::equal(bench::policy(), v.begin(), v.end(), d_v.begin()));
+  }
+  bench::set_bytes(state, n * sizeof(int));
+}
+BENCHMARK(equal_host_device)->Apply(bench::element_counts);
+
+void lower_bound(benchmark::State& state) {
+  std::size_t n = state.range(0);
+  auto haystack = bench::device_vector<int>(n);
+  thrust::sequence(bench::policy(), haystack.begin(), haystack.end(), 0, 2);
+  auto needles = bench::random_device_vector<int>(n, 2 * int(n));
+  auto result = bench::device_vector<std::size_t>(n);
+
+  for (auto _ : state) {
+    thrust::lower_bound(bench::policy(), haystack.begin(), haystack.end(),
+                        needles.begin(), needles.end(), result.begin());
+  }
+  state.SetItemsProcessed(std::int64_t(state.iterations()) * n);
+}
+BENCHMARK(lower_bound)->Apply(bench::element_counts);
+
+void merge(benchmark::State& state) {
+  std::size_t n = state.range(0);
+  auto a = bench::random_device_vector<int>(n / 2, 1 << 30);
+  auto b = bench::random_device_vector<int>(n - n / 2, 1 << 30);
+  thrust::sort(bench::policy(), a.begin(), a.end());
+  thrust::sort(bench::policy(), b.begin(), b.end());
+  auto result = bench::device_vector<int>(n);
+
+  for (auto _ : state) {
+    thrust::merge(bench::policy(), a.begin(), a.end(), b.begin(), b.end(),
+                  result.begin());
+  }
+  bench::set_bytes(state, 2 * n * sizeof(int));
+}
+BENCHMARK(merge)->Apply(bench::element_counts);
+
+void histogram(benchmark::State& state) {
+  std::size_t n = state.range(0);
+  auto x = bench::random_device_vector<int>(n, 255);
+  auto counts = bench::device_vector<unsigned int>(256);
+
+  for (auto _ : state) {
+    thrust::histogram(bench::policy(), x.begin(), x.end(), counts.begin(),
+                      256, 0, 256);
+  }
+  bench::set_bytes(state, n * sizeof(int));
+}
+BENCHMARK(histogram)->Apply(bench::element_counts);
+
+// Matrix with n rows and 8 nonzeros per row, spread over the columns.
+void spmv(benchmark::State& state) {
+  constexpr std::size_t per_row = 8;
+  std::size_t num_rows = state.range(0) / per_row;
+  std::size_t nnz = num_rows * per_row;
+
+  std::vector<int> row_offsets(num_rows + 1);
+  std::vector<int> column_indices(nnz);
+  for (std::size_t i = 0; i <= num_rows; i++) {
+    row_offsets[i] = int(i * per_row);
+  }
+  for (std::size_t k = 0; k < nnz; k++) {
+    std::size_t row = k / per_row;
+    column_indices[k] = int((row + (k % per_row) * 1031) % num_rows);
+  }
+  for (std::size_t i = 0; i < num_rows; i++) {
+    std::sort(column_indices.begin() + i * per_row,
+              column_indices.begin() + (i + 1) * per_row);
+  }
+
+  auto d_values = bench::random_device_vector<float>(nnz, 10);
+  auto d_row_offsets = bench::device_vector<int>(num_rows + 1);
+  auto d_column_indices = bench::device_vector<int>(nnz);
+  thrust::copy(bench::policy(), row_offsets.begin(), row_offsets.end(),
+               d_row_offsets.begin());
+  thrust::copy(bench::policy(), column_indices.begin(), column_indices.end(),
+               d_column_indices.begin());
+  auto x = bench::random_device_vector<float>(num_rows, 10);
+  auto y = bench::device_vector<float>(num_rows);
+
+  auto a = thrust::sparse::make_csr_view(num_rows, num_rows, d_values,
+                                         d_row_offsets, d_column_indices);
+
+  for (auto _ : state) {
+    thrust::sparse::spmv(bench::policy(), a, x.data(), y.data());
+  }
+  bench::set_bytes(state, nnz * (sizeof(float) + sizeof(int)));
+}
+BENCHMARK(spmv)->Apply(bench::element_counts);
+
+} // namespace
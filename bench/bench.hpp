@@ -0,0 +1,73 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <thrust/copy.h>
+#include <thrust/device_allocator.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+
+namespace bench {
+
+// Queue every benchmark runs on.  The CPU device is used so that results
+// can be collected, and compared across releases, on machines without a GPU.
+inline sycl::queue& queue() {
+  static sycl::queue q(sycl::cpu_selector_v);
+  return q;
+}
+
+inline thrust::execution_policy policy() {
+  return thrust::execution_policy(queue());
+}
+
+template <typename T>
+thrust::device_vector<T> device_vector(std::size_t n) {
+  return thrust::device_vector<T>(n, thrust::device_allocator<T>(queue()));
+}
+
+// Uniformly distributed values in [0, max_value], the same on every run.
+template <typename T>
+std::vector<T> random_values(std::size_t n, T max_value) {
+  std::mt19937 g(0);
+  std::uniform_int_distribution<long long> d(0, max_value);
+
+  std::vector<T> v(n);
+  for (T& x : v) {
+    x = T(d(g));
+  }
+  return v;
+}
+
+template <typename T>
+thrust::device_vector<T> random_device_vector(std::size_t n, T max_value) {
+  std::vector<T> v = random_values(n, max_value);
+  thrust::device_vector<T> d_v = device_vector<T>(n);
+  thrust::copy(policy(), v.begin(), v.end(), d_v.begin());
+  return d_v;
+}
+
+// Report the bytes each iteration reads or writes, from which Google
+// Benchmark derives the bandwidth.
+inline void set_bytes(benchmark::State& state, std::size_t bytes) {
+  state.SetBytesProcessed(std::int64_t(state.iterations()) *
+                          std::int64_t(bytes));
+}
+
+// Transfer sizes in bytes, from 4 B to 1 GB.
+inline void transfer_sizes(benchmark::internal::Benchmark* b) {
+  b->RangeMultiplier(16)->Range(4, std::int64_t(1) << 30);
+}
+
+// Element counts for algorithms, from 1K to 64M.
+inline void element_counts(benchmark::internal::Benchmark* b) {
+  b->RangeMultiplier(8)->Range(1 << 10, 1 << 26);
+}
+
+} // namespace bench
@@ -0,0 +1,26 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "bench.hpp"
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  // Recorded in the context of the JSON output, so results from different
+  // machines are not compared by mistake.
+  sycl::device device = bench::queue().get_device();
+  benchmark::AddCustomContext("sycl_device",
+                              device.get_info<sycl::info::device::name>());
+  benchmark::AddCustomContext(
+      "sycl_compute_units",
+      std::to_string(
+          device.get_info<sycl::info::device::max_compute_units>()));
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
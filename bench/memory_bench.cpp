@@ -0,0 +1,186 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include <thrust/caching_device_allocator.h>
+#include <thrust/copy.h>
+#include <thrust/device_allocator.h>
+#include <thrust/device_vector.h>
+#include <thrust/fill.h>
+#include <thrust/host_vector.h>
+#include <thrust/pinned_allocator.h>
+
+#include "bench.hpp"
+
+namespace {
+
+void allocate(benchmark::State& state) {
+  std::size_t bytes = state.range(0);
+  thrust::device_allocator<std::byte> alloc(bench::queue());
+
+  for (auto _ : state) {
+    auto ptr = alloc.allocate(bytes);
+    benchmark::DoNotOptimize(ptr);
+    alloc.deallocate(ptr, bytes);
+  }
+}
+BENCHMARK(allocate)->Apply(bench::transfer_sizes);
+
+void caching_allocate(benchmark::State& state) {
+  std::size_t bytes = state.range(0);
+  thrust::caching_device_allocator<std::byte> alloc(bench::queue());
+
+  for (auto _ : state) {
+    auto ptr = alloc.allocate(bytes);
+    benchmark::DoNotOptimize(ptr);
+    alloc.deallocate(ptr, bytes);
+  }
+}
+BENCHMARK(caching_allocate)->Apply(bench::transfer_sizes);
+
+thrust::host_vector<std::byte> pinned_vector(std::size_t bytes) {
+  return thrust::host_vector<std::byte>(
+      bytes, thrust::pinned_allocator<std::byte>(bench::queue()));
+}
+
+void copy_pageable_to_device(benchmark::State& state) {
+  std::size_t bytes = state.range(0);
+  std::vector<std::byte> src(bytes);
+  auto dst = bench::device_vector<std::byte>(bytes);
+
+  for (auto _ : state) {
+    thrust::copy(bench::policy(), src.begin(), src.end(), dst.begin());
+  }
+  bench::set_bytes(state, bytes);
+}
+BENCHMARK(copy_pageable_to_device)->Apply(bench::transfer_sizes);
+
+void copy_pinned_to_device(benchmark::State& state) {
+  std::size_t bytes = state.range(0);
+  auto src = pinned_vector(bytes);
+  auto dst = bench::device_vector<std::byte>(bytes);
+
+  for (auto _ : state) {
+    thrust::copy(bench::policy(), src.begin(), src.end(), dst.begin());
+  }
+  bench::set_bytes(state, bytes);
+}
+BENCHMARK(copy_pinned_to_device)->Apply(bench::transfer_sizes);
+
+void copy_device_to_pageable(benchmark::State& state) {
+  std::size_t bytes = state.range(0);
+  auto src = bench::device_vector<std::byte>(bytes);
+  std::vector<std::byte> dst(bytes);
+
+  for (auto _ : state) {
+    thrust::copy(bench::policy(), src.begin(), src.end(), dst.begin());
+  }
+  bench::set_bytes(state, bytes);
+}
+BENCHMARK(copy_device_to_pageable)->Apply(bench::transfer_sizes);
+
+void copy_device_to_pinned(benchmark::State& state) {
+  std::size_t bytes = state.range(0);
+  auto src = bench::device_vector<std::byte>(bytes);
+  auto dst = pinned_vector(bytes);
+
+  for (auto _ : state) {
+    thrust::copy(bench::policy(), src.begin(), src.end(), dst.begin());
+  }
+  bench::set_bytes(state, bytes);
+}
+BENCHMARK(copy_device_to_pinned)->Apply(bench::transfer_sizes);
+
+// A non-contiguous host range, streamed through pinned memory in chunks of
+// the given size.
+void copy_deque_to_device(benchmark::State& state) {
+  std::size_t n = std::size_t(64) << 20;
+  std::size_t chunk_bytes = state.range(0);
+  std::deque<int> src(n, 7);
+  auto dst = bench::device_vector<int>(n);
+  auto policy = bench::policy().with_transfer_chunk_size(chunk_bytes);
+
+  for (auto _ : state) {
+    thrust::copy(policy, src.begin(), src.end(), dst.begin());
+  }
+  bench::set_bytes(state, n * sizeof(int));
+}
+BENCHMARK(copy_deque_to_device)->RangeMultiplier(4)->Range(1 << 16, 1 << 26);
+
+void copy_device_to_device(benchmark::State& state) {
+  std::size_t bytes = state.range(0);
+  auto src = bench::device_vector<std::byte>(bytes);
+  auto dst = bench::device_vector<std::byte>(bytes);
+
+  for (auto _ : state) {
+    thrust::copy(bench::policy(), src.begin(), src.end(), dst.begin());
+  }
+  // Each byte is both read and written.
+  bench::set_bytes(state, 2 * bytes);
+}
+BENCHMARK(copy_device_to_device)->Apply(bench::transfer_sizes);
+
+void fill(benchmark::State& state) {
+  std::size_t n = state.range(0) / sizeof(int);
+  auto v = bench::device_vector<int>(n);
+
+  for (auto _ : state) {
+    thrust::fill(bench::policy(), v.begin(), v.end(), 7);
+  }
+  bench::set_bytes(state, n * sizeof(int));
+}
+BENCHMARK(fill)->Apply(bench::transfer_sizes);
+
+// Single-element accesses through `device_reference`, each of which is a
+// round trip to the device.
+void device_reference_read(benchmark::State& state) {
+  auto v = bench::device_vector<int>(1);
+
+  for (auto _ : state) {
+    int x = v[0];
+    benchmark::DoNotOptimize(x);
+  }
+}
+BENCHMARK(device_reference_read);
+
+void device_reference_write(benchmark::State& state) {
+  auto v = bench::device_vector<int>(1);
+
+  int x = 0;
+  for (auto _ : state) {
+    v[0] = x++;
+  }
+}
+BENCHMARK(device_reference_write);
+
+void device_vector_push_back(benchmark::State& state) {
+  std::size_t n = state.range(0);
+
+  for (auto _ : state) {
+    thrust::device_vector<int> v(thrust::device_allocator<int>(bench::queue()));
+    for (std::size_t i = 0; i < n; i++) {
+      v.push_back(int(i));
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(std::int64_t(state.iterations()) * n);
+}
+BENCHMARK(device_vector_push_back)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+void device_vector_resize(benchmark::State& state) {
+  std::size_t n = state.range(0);
+
+  for (auto _ : state) {
+    thrust::device_vector<int> v(thrust::device_allocator<int>(bench::queue()));
+    for (std::size_t size = 1; size <= n; size *= 2) {
+      v.resize(size);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  bench::set_bytes(state, n * sizeof(int));
+}
+BENCHMARK(device_vector_resize)->Apply(bench::element_counts);
+
+} // namespace
@@ -0,0 +1,368 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <thrust/detail/binary_search.hpp>
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Single searches in a sorted range return a pointer to the bound, or under
+// `par_nowait` a `future` holding it.
+
+template <typename ExecutionPolicy, typename T, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto lower_bound(ExecutionPolicy&& policy, device_ptr<T> first,
+                 device_ptr<T> last, const U& value, Compare comp) {
+  return __detail::search_one<device_ptr<T>>(
+      policy, first.get(), std::distance(first, last), value,
+      __detail::before_lower_bound<Compare>{comp},
+      [=](std::size_t k) { return first + k; });
+}
+
+template <typename ExecutionPolicy, typename T, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto lower_bound(ExecutionPolicy&& policy, device_ptr<T> first,
+                 device_ptr<T> last, const U& value) {
+  return thrust::lower_bound(policy, first, last, value,
+                             std::less<std::remove_const_t<T>>());
+}
+
+template <typename T, typename U, typename Compare>
+device_ptr<T> lower_bound(device_ptr<T> first, device_ptr<T> last,
+                          const U& value, Compare comp) {
+  execution_policy policy(__detail::get_pointer_queue(first.get()));
+  return thrust::lower_bound(policy, first, last, value, comp);
+}
+
+template <typename T, typename U>
+device_ptr<T> lower_bound(device_ptr<T> first, device_ptr<T> last,
+                          const U& value) {
+  return thrust::lower_bound(first, last, value,
+                             std::less<std::remove_const_t<T>>());
+}
+
+template <typename ExecutionPolicy, typename T, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto upper_bound(ExecutionPolicy&& policy, device_ptr<T> first,
+                 device_ptr<T> last, const U& value, Compare comp) {
+  return __detail::search_one<device_ptr<T>>(
+      policy, first.get(), std::distance(first, last), value,
+      __detail::before_upper_bound<Compare>{comp},
+      [=](std::size_t k) { return first + k; });
+}
+
+template <typename ExecutionPolicy, typename T, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto upper_bound(ExecutionPolicy&& policy, device_ptr<T> first,
+                 device_ptr<T> last, const U& value) {
+  return thrust::upper_bound(policy, first, last, value,
+                             std::less<std::remove_const_t<T>>());
+}
+
+template <typename T, typename U, typename Compare>
+device_ptr<T> upper_bound(device_ptr<T> first, device_ptr<T> last,
+                          const U& value, Compare comp) {
+  execution_policy policy(__detail::get_pointer_queue(first.get()));
+  return thrust::upper_bound(policy, first, last, value, comp);
+}
+
+template <typename T, typename U>
+device_ptr<T> upper_bound(device_ptr<T> first, device_ptr<T> last,
+                          const U& value) {
+  return thrust::upper_bound(first, last, value,
+                             std::less<std::remove_const_t<T>>());
+}
+
+// Whether the sorted range holds an element equivalent to `value`, as a
+// `future<bool>` under `par_nowait`.
+template <typename ExecutionPolicy, typename T, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto binary_search(ExecutionPolicy&& policy, device_ptr<T> first,
+                   device_ptr<T> last, const U& value, Compare comp) {
+  const T* data = first.get();
+  std::size_t n = std::distance(first, last);
+
+  return __detail::search_one<bool>(
+      policy, data, n, value, __detail::before_lower_bound<Compare>{comp},
+      [=](std::size_t k) { return k < n && !comp(value, data[k]); });
+}
+
+template <typename ExecutionPolicy, typename T, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto binary_search(ExecutionPolicy&& policy, device_ptr<T> first,
+                   device_ptr<T> last, const U& value) {
+  return thrust::binary_search(policy, first, last, value,
+                               std::less<std::remove_const_t<T>>());
+}
+
+template <typename T, typename U, typename Compare>
+bool binary_search(device_ptr<T> first, device_ptr<T> last, const U& value,
+                   Compare comp) {
+  execution_policy policy(__detail::get_pointer_queue(first.get()));
+  return thrust::binary_search(policy, first, last, value, comp);
+}
+
+template <typename T, typename U>
+bool binary_search(device_ptr<T> first, device_ptr<T> last, const U& value) {
+  return thrust::binary_search(first, last, value,
+                               std::less<std::remove_const_t<T>>());
+}
+
+// Both bounds of `value`, as a pair of `future`s under `par_nowait`.
+template <typename ExecutionPolicy, typename T, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto equal_range(ExecutionPolicy&& policy, device_ptr<T> first,
+                 device_ptr<T> last, const U& value, Compare comp) {
+  return std::pair{thrust::lower_bound(policy, first, last, value, comp),
+                   thrust::upper_bound(policy, first, last, value, comp)};
+}
+
+template <typename ExecutionPolicy, typename T, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto equal_range(ExecutionPolicy&& policy, device_ptr<T> first,
+                 device_ptr<T> last, const U& value) {
+  return thrust::equal_range(policy, first, last, value,
+                             std::less<std::remove_const_t<T>>());
+}
+
+template <typename T, typename U, typename Compare>
+std::pair<device_ptr<T>, device_ptr<T>>
+equal_range(device_ptr<T> first, device_ptr<T> last, const U& value,
+            Compare comp) {
+  execution_policy policy(__detail::get_pointer_queue(first.get()));
+  return thrust::equal_range(policy, first, last, value, comp);
+}
+
+template <typename T, typename U>
+std::pair<device_ptr<T>, device_ptr<T>>
+equal_range(device_ptr<T> first, device_ptr<T> last, const U& value) {
+  return thrust::equal_range(first, last, value,
+                             std::less<std::remove_const_t<T>>());
+}
+
+// Vectorized searches look up every value in [values_first, values_last) and
+// write, for each one, the index of its bound in the sorted range (or, for
+// `binary_search`, whether it was found) to `result`.  The top levels of the
+// search are answered from splitters held in local memory.
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator ValueIter, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !std::is_const_v<U>)
+auto lower_bound(ExecutionPolicy&& policy, Iter first, Iter last,
+                 ValueIter values_first, ValueIter values_last,
+                 device_ptr<U> result, Compare comp) {
+  U* out = result.get();
+  auto e = __detail::search_many(
+      policy, first, std::distance(first, last), values_first,
+      std::distance(values_first, values_last),
+      __detail::before_lower_bound<Compare>{comp},
+      [=](std::size_t i, const auto&, std::size_t k) { out[i] = U(k); });
+  return __detail::complete(policy, e);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator ValueIter, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !std::is_const_v<U>)
+auto lower_bound(ExecutionPolicy&& policy, Iter first, Iter last,
+                 ValueIter values_first, ValueIter values_last,
+                 device_ptr<U> result) {
+  return thrust::lower_bound(policy, first, last, values_first, values_last,
+                             result, std::less<std::iter_value_t<Iter>>());
+}
+
+template <__detail::device_iterator Iter, __detail::device_iterator ValueIter,
+          typename U, typename Compare>
+  requires(!std::is_const_v<U>)
+void lower_bound(Iter first, Iter last, ValueIter values_first,
+                 ValueIter values_last, device_ptr<U> result, Compare comp) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::lower_bound(policy, first, last, values_first, values_last, result,
+                      comp);
+}
+
+template <__detail::device_iterator Iter, __detail::device_iterator ValueIter,
+          typename U>
+  requires(!std::is_const_v<U>)
+void lower_bound(Iter first, Iter last, ValueIter values_first,
+                 ValueIter values_last, device_ptr<U> result) {
+  thrust::lower_bound(first, last, values_first, values_last, result,
+                      std::less<std::iter_value_t<Iter>>());
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator ValueIter, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !std::is_const_v<U>)
+auto upper_bound(ExecutionPolicy&& policy, Iter first, Iter last,
+                 ValueIter values_first, ValueIter values_last,
+                 device_ptr<U> result, Compare comp) {
+  U* out = result.get();
+  auto e = __detail::search_many(
+      policy, first, std::distance(first, last), values_first,
+      std::distance(values_first, values_last),
+      __detail::before_upper_bound<Compare>{comp},
+      [=](std::size_t i, const auto&, std::size_t k) { out[i] = U(k); });
+  return __detail::complete(policy, e);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator ValueIter, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !std::is_const_v<U>)
+auto upper_bound(ExecutionPolicy&& policy, Iter first, Iter last,
+                 ValueIter values_first, ValueIter values_last,
+                 device_ptr<U> result) {
+  return thrust::upper_bound(policy, first, last, values_first, values_last,
+                             result, std::less<std::iter_value_t<Iter>>());
+}
+
+template <__detail::device_iterator Iter, __detail::device_iterator ValueIter,
+          typename U, typename Compare>
+  requires(!std::is_const_v<U>)
+void upper_bound(Iter first, Iter last, ValueIter values_first,
+                 ValueIter values_last, device_ptr<U> result, Compare comp) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::upper_bound(policy, first, last, values_first, values_last, result,
+                      comp);
+}
+
+template <__detail::device_iterator Iter, __detail::device_iterator ValueIter,
+          typename U>
+  requires(!std::is_const_v<U>)
+void upper_bound(Iter first, Iter last, ValueIter values_first,
+                 ValueIter values_last, device_ptr<U> result) {
+  thrust::upper_bound(first, last, values_first, values_last, result,
+                      std::less<std::iter_value_t<Iter>>());
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator ValueIter, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !std::is_const_v<U>)
+auto binary_search(ExecutionPolicy&& policy, Iter first, Iter last,
+                   ValueIter values_first, ValueIter values_last,
+                   device_ptr<U> result, Compare comp) {
+  using T = std::iter_value_t<Iter>;
+  std::size_t n = std::distance(first, last);
+  U* out = result.get();
+
+  auto load = [=](std::size_t k) {
+    return T(__detail::kernel_reference(first, k));
+  };
+
+  auto e = __detail::search_many(
+      policy, first, n, values_first, std::distance(values_first, values_last),
+      __detail::before_lower_bound<Compare>{comp},
+      [=](std::size_t i, const auto& value, std::size_t k) {
+        out[i] = U(k < n && !comp(value, load(k)));
+      });
+  return __detail::complete(policy, e);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator ValueIter, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !std::is_const_v<U>)
+auto binary_search(ExecutionPolicy&& policy, Iter first, Iter last,
+                   ValueIter values_first, ValueIter values_last,
+                   device_ptr<U> result) {
+  return thrust::binary_search(policy, first, last, values_first, values_last,
+                               result, std::less<std::iter_value_t<Iter>>());
+}
+
+template <__detail::device_iterator Iter, __detail::device_iterator ValueIter,
+          typename U, typename Compare>
+  requires(!std::is_const_v<U>)
+void binary_search(Iter first, Iter last, ValueIter values_first,
+                   ValueIter values_last, device_ptr<U> result, Compare comp) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::binary_search(policy, first, last, values_first, values_last, result,
+                        comp);
+}
+
+template <__detail::device_iterator Iter, __detail::device_iterator ValueIter,
+          typename U>
+  requires(!std::is_const_v<U>)
+void binary_search(Iter first, Iter last, ValueIter values_first,
+                   ValueIter values_last, device_ptr<U> result) {
+  thrust::binary_search(first, last, values_first, values_last, result,
+                        std::less<std::iter_value_t<Iter>>());
+}
+
+// Both bounds of every value.  The upper bound is searched for starting from
+// the lower bound, so each value's range is found by a single kernel.
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator ValueIter, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !std::is_const_v<U>)
+auto equal_range(ExecutionPolicy&& policy, Iter first, Iter last,
+                 ValueIter values_first, ValueIter values_last,
+                 device_ptr<U> lower_result, device_ptr<U> upper_result,
+                 Compare comp) {
+  using T = std::iter_value_t<Iter>;
+  std::size_t n = std::distance(first, last);
+  U* lower_out = lower_result.get();
+  U* upper_out = upper_result.get();
+
+  auto load = [=](std::size_t k) {
+    return T(__detail::kernel_reference(first, k));
+  };
+
+  auto e = __detail::search_many(
+      policy, first, n, values_first, std::distance(values_first, values_last),
+      __detail::before_lower_bound<Compare>{comp},
+      [=](std::size_t i, const auto& value, std::size_t k) {
+        lower_out[i] = U(k);
+        upper_out[i] = U(__detail::search_bound(
+            load, k, n, value, __detail::before_upper_bound<Compare>{comp}));
+      });
+  return __detail::complete(policy, e);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator ValueIter, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !std::is_const_v<U>)
+auto equal_range(ExecutionPolicy&& policy, Iter first, Iter last,
+                 ValueIter values_first, ValueIter values_last,
+                 device_ptr<U> lower_result, device_ptr<U> upper_result) {
+  return thrust::equal_range(policy, first, last, values_first, values_last,
+                             lower_result, upper_result,
+                             std::less<std::iter_value_t<Iter>>());
+}
+
+template <__detail::device_iterator Iter, __detail::device_iterator ValueIter,
+          typename U, typename Compare>
+  requires(!std::is_const_v<U>)
+void equal_range(Iter first, Iter last, ValueIter values_first,
+                 ValueIter values_last, device_ptr<U> lower_result,
+                 device_ptr<U> upper_result, Compare comp) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::equal_range(policy, first, last, values_first, values_last,
+                      lower_result, upper_result, comp);
+}
+
+template <__detail::device_iterator Iter, __detail::device_iterator ValueIter,
+          typename U>
+  requires(!std::is_const_v<U>)
+void equal_range(Iter first, Iter last, ValueIter values_first,
+                 ValueIter values_last, device_ptr<U> lower_result,
+                 device_ptr<U> upper_result) {
+  thrust::equal_range(first, last, values_first, values_last, lower_result,
+                      upper_result, std::less<std::iter_value_t<Iter>>());
+}
+
+} // namespace thrust
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <memory>
+
+#include <thrust/detail/default_selector.hpp>
+#include <thrust/detail/device_memory_pool.hpp>
+#include <thrust/device_ptr.h>
+
+namespace thrust {
+
+// Device allocator that recycles freed blocks instead of returning them to
+// the SYCL runtime.  All allocators for the same (context, device) share one
+// pool, so temporaries created and destroyed in a loop reuse the same memory.
+template <typename T>
+  requires(std::is_trivially_copyable_v<T>)
+class caching_device_allocator {
+public:
+  using value_type = T;
+  using pointer = device_ptr<T>;
+  using const_pointer = device_ptr<const T>;
+  using reference = device_reference<T>;
+  using const_reference = device_reference<const T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  template <typename U>
+  caching_device_allocator(const caching_device_allocator<U>& other) noexcept
+      : pool_(other.get_pool()) {}
+
+  caching_device_allocator()
+      : caching_device_allocator(sycl::queue(thrust::default_selector_v)) {}
+
+  caching_device_allocator(const sycl::queue& q)
+      : caching_device_allocator(q.get_context(), q.get_device()) {}
+
+  caching_device_allocator(const sycl::context& ctxt, const sycl::device& dev)
+      : pool_(__detail::device_memory_pool::get(ctxt, dev)) {}
+
+  caching_device_allocator(const caching_device_allocator&) = default;
+  caching_device_allocator& operator=(const caching_device_allocator&) =
+      default;
+  ~caching_device_allocator() = default;
+
+  using is_always_equal = std::false_type;
+
+  pointer allocate(std::size_t size) {
+    return pointer(static_cast<T*>(pool_->allocate(size * sizeof(T))));
+  }
+
+  void deallocate(pointer ptr, std::size_t n) {
+    pool_->deallocate(ptr.get(), n * sizeof(T));
+  }
+
+  bool operator==(const caching_device_allocator&) const = default;
+  bool operator!=(const caching_device_allocator&) const = default;
+
+  template <typename U>
+  struct rebind {
+    using other = caching_device_allocator<U>;
+  };
+
+  // Upper bound on the bytes kept in free blocks.  Lowering it frees cached
+  // blocks immediately.
+  void set_max_cached_bytes(std::size_t max_cached_bytes) {
+    pool_->set_max_cached_bytes(max_cached_bytes);
+  }
+
+  std::size_t max_cached_bytes() const {
+    return pool_->max_cached_bytes();
+  }
+
+  // Free cached blocks until at most `target_bytes` remain cached.
+  void trim(std::size_t target_bytes = 0) {
+    pool_->trim(target_bytes);
+  }
+
+  // Return every cached block to the SYCL runtime.
+  void release() {
+    pool_->release();
+  }
+
+  caching_allocator_stats stats() const {
+    return pool_->stats();
+  }
+
+  sycl::device get_device() const noexcept {
+    return pool_->get_device();
+  }
+
+  sycl::context get_context() const noexcept {
+    return pool_->get_context();
+  }
+
+  const std::shared_ptr<__detail::device_memory_pool>&
+  get_pool() const noexcept {
+    return pool_;
+  }
+
+private:
+  std::shared_ptr<__detail::device_memory_pool> pool_;
+};
+
+} // namespace thrust
@@ -2,14 +2,75 @@
 
 #include <sycl/sycl.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <type_traits>
+#include <vector>
 
+#include <thrust/detail/compact.hpp>
 #include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/pipelined_copy.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
 #include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
 
 namespace thrust {
 
+namespace __detail {
+
+// Copy `count` elements between two USM allocations.  Pointers that live on
+// the same device and context are copied with a single memcpy; anything else
+// (different devices or contexts) is staged through one host buffer, since
+// device allocations are not guaranteed to be accessible across devices.
+template <typename T>
+void copy_device_to_device(const T* first, std::size_t count,
+                           std::remove_const_t<T>* d_first) {
+  if (count == 0) {
+    return;
+  }
+
+  sycl::queue src_q = get_pointer_queue(first);
+  sycl::queue dst_q = get_pointer_queue(d_first);
+
+  if (src_q.get_context() == dst_q.get_context() &&
+      src_q.get_device() == dst_q.get_device()) {
+    dst_q.memcpy(d_first, first, count * sizeof(T)).wait();
+  } else {
+    std::vector<std::remove_const_t<T>> buffer(count);
+    src_q.memcpy(buffer.data(), first, count * sizeof(T)).wait();
+    dst_q.memcpy(d_first, buffer.data(), count * sizeof(T)).wait();
+  }
+}
+
+// Write the elements of a device iterator range to device memory with one
+// kernel, evaluating fancy iterators on the fly.
+template <typename ExecutionPolicy, typename Iter, typename T>
+sycl::event copy_iterator_to_device(ExecutionPolicy&& policy, Iter first,
+                                    std::size_t count, T* d_first) {
+  return policy.get_queue().submit([&](sycl::handler& h) {
+    h.depends_on(policy.get_dependencies());
+
+    h.parallel_for(sycl::range<1>(count), [=](sycl::id<1> i) {
+      d_first[i] = T(std::iter_value_t<Iter>(first[i[0]]));
+    });
+  });
+}
+
+} // namespace __detail
+
+// Copy between two host ranges, such as a `std::vector` and a `host_vector`.
+template <std::contiguous_iterator I, std::contiguous_iterator O>
+  requires(!__detail::is_device_ptr_v<I> && !__detail::is_device_ptr_v<O> &&
+           std::is_same_v<std::iter_value_t<I>, std::iter_value_t<O>> &&
+           std::is_trivially_copyable_v<std::iter_value_t<I>>)
+void copy(I first, I last, O d_first) {
+  std::copy(first, last, d_first);
+}
+
 template <std::contiguous_iterator I, typename T>
   requires(std::is_same_v<std::iter_value_t<I>, std::remove_const_t<T>> &&
            std::is_trivially_copyable_v<T>)
@@ -32,25 +93,282 @@ void copy(device_ptr<T> first, device_ptr<T> last, O d_first) {
       .wait();
 }
 
+// Host memory that the policy's device cannot access directly and that
+// spans more than one transfer chunk is streamed through pinned buffers a
+// chunk at a time under any policy, so even under `par_nowait` the call
+// blocks until all but the last chunk have been sent.  Under `par_nowait`,
+// smaller such ranges are staged through one pinned buffer once the policy's
+// dependencies have completed, so the transfer itself is a DMA that does not
+// block the caller.  Either way the source range may be reused as soon as
+// `copy` returns.
 template <typename ExecutionPolicy, std::contiguous_iterator I, typename T>
-  requires(std::is_same_v<std::iter_value_t<I>, std::remove_const_t<T>> &&
+  requires(std::is_same_v<std::iter_value_t<I>, T> &&
            std::is_trivially_copyable_v<T>)
-void copy(ExecutionPolicy&& policy, I first, I last, device_ptr<T> d_first) {
-  policy.get_queue()
-      .memcpy(d_first.get(), std::to_address(first),
-              std::distance(first, last) * sizeof(T))
-      .wait();
+auto copy(ExecutionPolicy&& policy, I first, I last, device_ptr<T> d_first) {
+  std::size_t bytes = std::distance(first, last) * sizeof(T);
+  const void* src = std::to_address(first);
+
+  if (bytes > policy.get_transfer_chunk_size() &&
+      !__detail::is_device_accessible(src, policy.get_context())) {
+    return __detail::pipelined_copy_to_device(policy, first, last,
+                                              d_first.get(), bytes / sizeof(T));
+  }
+
+  __detail::profile_transfer(policy, transfer_direction::host_to_device,
+                             bytes);
+
+  if constexpr (__detail::is_nowait_policy_v<ExecutionPolicy>) {
+    if (bytes > 0 &&
+        !__detail::is_device_accessible(src, policy.get_context())) {
+      // The dependencies may still be writing the source.
+      sycl::event::wait(policy.get_dependencies());
+      __detail::staging_buffer<std::byte> staging(policy, bytes);
+      std::memcpy(staging.data(), src, bytes);
+      auto e = policy.get_queue().memcpy(d_first.get(), staging.data(), bytes);
+      return __detail::complete(policy, e, std::move(staging));
+    }
+  }
+
+  auto e = policy.get_queue().memcpy(d_first.get(), src, bytes,
+                                     policy.get_dependencies());
+  return __detail::complete(policy, e);
 }
 
+// Under `par_nowait`, a destination the device cannot access receives the data
+// through two pinned buffers of one transfer chunk each: the device writes a
+// chunk into a buffer with a DMA and a host task then copies it into place,
+// so no step blocks the caller.  Under blocking policies, such a destination
+// spanning more than one transfer chunk is filled a chunk at a time, each
+// chunk unpacked while the next transfers.
 template <typename ExecutionPolicy, typename T, std::contiguous_iterator O>
   requires(std::is_same_v<std::iter_value_t<O>, std::remove_const_t<T>> &&
            std::is_trivially_copyable_v<T>)
-void copy(ExecutionPolicy&& policy, device_ptr<T> first, device_ptr<T> last,
+auto copy(ExecutionPolicy&& policy, device_ptr<T> first, device_ptr<T> last,
           O d_first) {
-  policy.get_queue()
-      .memcpy(std::to_address(d_first), first.get(),
-              std::distance(first, last) * sizeof(T))
-      .wait();
+  std::size_t bytes = std::distance(first, last) * sizeof(T);
+  void* dst = std::to_address(d_first);
+
+  if constexpr (!__detail::is_nowait_policy_v<ExecutionPolicy>) {
+    if (bytes > policy.get_transfer_chunk_size() &&
+        !__detail::is_device_accessible(dst, policy.get_context())) {
+      return __detail::pipelined_copy_to_host(policy, first.get(),
+                                              bytes / sizeof(T), d_first);
+    }
+  }
+
+  if constexpr (__detail::is_nowait_policy_v<ExecutionPolicy>) {
+    if (bytes > 0 &&
+        !__detail::is_device_accessible(dst, policy.get_context())) {
+      return __detail::queued_copy_to_host(
+          policy, first.get(), bytes / sizeof(T), std::to_address(d_first));
+    }
+  }
+
+  __detail::profile_transfer(policy, transfer_direction::device_to_host,
+                             bytes);
+
+  auto e = policy.get_queue().memcpy(dst, first.get(), bytes,
+                                     policy.get_dependencies());
+  return __detail::complete(policy, e);
+}
+
+// Host ranges that are not contiguous, such as a `std::list`, a `std::deque`
+// or a generator view, are read once, packed a chunk at a time into pinned
+// buffers, and streamed to the device, the packing of each chunk overlapping
+// the transfer of the one before.  Elements are converted to U on the host.
+// Under `par_nowait` only the last chunk's transfer may still be running
+// when `copy` returns.
+template <typename ExecutionPolicy, std::input_iterator I,
+          std::sentinel_for<I> S, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !std::contiguous_iterator<I> && !__detail::device_iterator<I> &&
+           std::is_convertible_v<std::iter_reference_t<I>, U> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto copy(ExecutionPolicy&& policy, I first, S last, device_ptr<U> d_first) {
+  std::size_t size = __detail::size_hint(first, last);
+  return __detail::pipelined_copy_to_device(policy, std::move(first), last,
+                                            d_first.get(), size);
+}
+
+template <std::input_iterator I, std::sentinel_for<I> S, typename U>
+  requires(!std::contiguous_iterator<I> && !__detail::device_iterator<I> &&
+           std::is_convertible_v<std::iter_reference_t<I>, U> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+void copy(I first, S last, device_ptr<U> d_first) {
+  execution_policy policy(__detail::get_pointer_queue(d_first.get()));
+  thrust::copy(policy, std::move(first), last, d_first);
+}
+
+// Device memory copied to a host output iterator that is not contiguous,
+// such as a `std::deque` iterator or a `std::back_inserter`, is transferred
+// a chunk at a time through pinned buffers, each chunk written out on the
+// host while the next transfers.  The output is complete when `copy`
+// returns, under any policy.
+template <typename ExecutionPolicy, typename T, typename O>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !std::contiguous_iterator<O> && !__detail::device_iterator<O> &&
+           std::output_iterator<O, std::remove_const_t<T>> &&
+           std::is_trivially_copyable_v<T>)
+auto copy(ExecutionPolicy&& policy, device_ptr<T> first, device_ptr<T> last,
+          O d_first) {
+  return __detail::pipelined_copy_to_host(
+      policy, first.get(), std::distance(first, last), d_first);
+}
+
+template <typename T, typename O>
+  requires(!std::contiguous_iterator<O> && !__detail::device_iterator<O> &&
+           std::output_iterator<O, std::remove_const_t<T>> &&
+           std::is_trivially_copyable_v<T>)
+void copy(device_ptr<T> first, device_ptr<T> last, O d_first) {
+  execution_policy policy(__detail::get_pointer_queue(first.get()));
+  thrust::copy(policy, first, last, d_first);
+}
+
+template <typename T, typename U>
+  requires(std::is_same_v<std::remove_const_t<T>, U> &&
+           std::is_trivially_copyable_v<T>)
+void copy(device_ptr<T> first, device_ptr<T> last, device_ptr<U> d_first) {
+  __detail::copy_device_to_device(first.get(), std::distance(first, last),
+                                  d_first.get());
+}
+
+template <typename ExecutionPolicy, typename T, typename U>
+  requires(std::is_same_v<std::remove_const_t<T>, U> &&
+           std::is_trivially_copyable_v<T>)
+auto copy(ExecutionPolicy&& policy, device_ptr<T> first, device_ptr<T> last,
+          device_ptr<U> d_first) {
+  sycl::queue src_q = __detail::get_pointer_queue(first.get());
+  sycl::queue dst_q = __detail::get_pointer_queue(d_first.get());
+  __detail::profile_transfer(policy, transfer_direction::device_to_device,
+                             std::distance(first, last) * sizeof(T));
+
+  sycl::event e;
+  if (src_q.get_device() == policy.get_device() &&
+      src_q.get_context() == policy.get_context() &&
+      dst_q.get_device() == policy.get_device() &&
+      dst_q.get_context() == policy.get_context()) {
+    e = policy.get_queue().memcpy(d_first.get(), first.get(),
+                                  std::distance(first, last) * sizeof(T),
+                                  policy.get_dependencies());
+  } else {
+    // Staged copies between devices or contexts complete before returning.
+    sycl::event::wait(policy.get_dependencies());
+    __detail::copy_device_to_device(first.get(), std::distance(first, last),
+                                    d_first.get());
+  }
+  return __detail::complete(policy, e);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter, typename U>
+  requires(!__detail::is_device_ptr_v<Iter> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto copy(ExecutionPolicy&& policy, Iter first, Iter last,
+          device_ptr<U> d_first) {
+  auto e = __detail::copy_iterator_to_device(
+      policy, first, std::distance(first, last), d_first.get());
+  return __detail::complete(policy, e);
+}
+
+template <__detail::device_iterator Iter, typename U>
+  requires(!__detail::is_device_ptr_v<Iter> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+void copy(Iter first, Iter last, device_ptr<U> d_first) {
+  execution_policy policy(__detail::get_pointer_queue(d_first.get()));
+  thrust::copy(policy, first, last, d_first);
+}
+
+// Fancy iterator ranges are evaluated into device scratch memory, which is
+// then copied to the host in one transfer.
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          std::contiguous_iterator O>
+  requires(!__detail::is_device_ptr_v<Iter> &&
+           std::is_trivially_copyable_v<std::iter_value_t<O>>)
+auto copy(ExecutionPolicy&& policy, Iter first, Iter last, O d_first) {
+  using value_type = std::iter_value_t<O>;
+  std::size_t count = std::distance(first, last);
+
+  __detail::temporary_buffer<value_type> buffer(policy, count);
+  __detail::profile_transfer(policy, transfer_direction::device_to_host,
+                             count * sizeof(value_type));
+  auto e = __detail::copy_iterator_to_device(policy, first, count,
+                                             buffer.data());
+  e = policy.get_queue().memcpy(std::to_address(d_first), buffer.data(),
+                                count * sizeof(value_type), e);
+  return __detail::complete(policy, e, std::move(buffer));
+}
+
+template <__detail::device_iterator Iter, std::contiguous_iterator O>
+  requires(!__detail::is_device_ptr_v<Iter> &&
+           std::is_trivially_copyable_v<std::iter_value_t<O>>)
+void copy(Iter first, Iter last, O d_first) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::copy(policy, first, last, d_first);
+}
+
+// Copy the elements for which `pred` holds to `result`, preserving their
+// order, and return the end of the output.  Under `par_nowait` the end is
+// returned as a `future`, so the output size can be consumed without waiting.
+template <typename ExecutionPolicy, __detail::device_iterator Iter, typename U,
+          typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto copy_if(ExecutionPolicy&& policy, Iter first, Iter last,
+             device_ptr<U> result, Predicate pred) {
+  using value_type = std::iter_value_t<Iter>;
+  U* out = result.get();
+
+  return __detail::compact_impl(
+      policy, std::distance(first, last),
+      [=](std::size_t i) {
+        value_type value(first[i]);
+        return __detail::counted_value<value_type>{pred(value) ? 1u : 0u,
+                                                   value};
+      },
+      __detail::count_op{},
+      [=](std::size_t k, const value_type& value) { out[k] = value; },
+      result);
+}
+
+template <__detail::device_iterator Iter, typename U, typename Predicate>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> copy_if(Iter first, Iter last, device_ptr<U> result,
+                      Predicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::copy_if(policy, first, last, result, pred);
+}
+
+// Copy the elements whose corresponding stencil element satisfies `pred`.
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator StencilIter, typename U,
+          typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto copy_if(ExecutionPolicy&& policy, Iter first, Iter last,
+             StencilIter stencil, device_ptr<U> result, Predicate pred) {
+  using value_type = std::iter_value_t<Iter>;
+  using stencil_type = std::iter_value_t<StencilIter>;
+  U* out = result.get();
+
+  return __detail::compact_impl(
+      policy, std::distance(first, last),
+      [=](std::size_t i) {
+        bool keep = pred(stencil_type(stencil[i]));
+        return __detail::counted_value<value_type>{keep ? 1u : 0u,
+                                                   value_type(first[i])};
+      },
+      __detail::count_op{},
+      [=](std::size_t k, const value_type& value) { out[k] = value; },
+      result);
+}
+
+template <__detail::device_iterator Iter,
+          __detail::device_iterator StencilIter, typename U,
+          typename Predicate>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> copy_if(Iter first, Iter last, StencilIter stencil,
+                      device_ptr<U> result, Predicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::copy_if(policy, first, last, stencil, result, pred);
 }
 
 } // namespace thrust
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/reduce.h>
+
+namespace thrust {
+
+// Number of elements for which `pred` holds, or under `par_nowait` a `future`
+// holding it.  Every element has to be examined, so this is a reduction
+// rather than an early-exit search.
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto count_if(ExecutionPolicy&& policy, Iter first, Iter last,
+              Predicate pred) {
+  using difference_type = std::iter_difference_t<Iter>;
+  return thrust::transform_reduce(
+      policy, first, last,
+      [=](const auto& value) { return difference_type(pred(value) ? 1 : 0); },
+      difference_type(0), std::plus<difference_type>());
+}
+
+template <__detail::device_iterator Iter, typename Predicate>
+std::iter_difference_t<Iter> count_if(Iter first, Iter last, Predicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::count_if(policy, first, last, pred);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename T>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto count(ExecutionPolicy&& policy, Iter first, Iter last, const T& value) {
+  return thrust::count_if(policy, first, last, [=](const auto& element) {
+    return element == value;
+  });
+}
+
+template <__detail::device_iterator Iter, typename T>
+std::iter_difference_t<Iter> count(Iter first, Iter last, const T& value) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::count(policy, first, last, value);
+}
+
+} // namespace thrust
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/kernel_config.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+
+namespace thrust {
+
+namespace __detail {
+
+// Predicates true for the elements of a sorted range that precede the lower
+// or upper bound of `value`.
+template <typename Compare>
+struct before_lower_bound {
+  Compare comp;
+
+  template <typename T, typename U>
+  bool operator()(const T& element, const U& value) const {
+    return comp(element, value);
+  }
+};
+
+template <typename Compare>
+struct before_upper_bound {
+  Compare comp;
+
+  template <typename T, typename U>
+  bool operator()(const T& element, const U& value) const {
+    return !comp(value, element);
+  }
+};
+
+// First index k in [first, last) for which `before(load(k), value)` is false.
+// `before` must be true on a prefix of the range.
+template <typename Load, typename U, typename Before>
+std::size_t search_bound(Load load, std::size_t first, std::size_t last,
+                         const U& value, Before before) {
+  while (first < last) {
+    std::size_t middle = first + (last - first) / 2;
+    if (before(load(middle), value)) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  return first;
+}
+
+// Search for one value with a single work-item and return
+// `finish(index)` for the index of its bound, as a `future` under
+// `par_nowait`.  `finish(0)` must be safe to call on the host when n is 0.
+template <typename R, typename ExecutionPolicy, typename T, typename U,
+          typename Before, typename Finish>
+auto search_one(ExecutionPolicy&& policy, const T* data, std::size_t n,
+                const U& value, Before before, Finish finish) {
+  if (n == 0) {
+    sycl::event::wait(policy.get_dependencies());
+    return ready_value(policy, R(finish(0)));
+  }
+
+  temporary_buffer<R> result_buffer(policy, 1);
+  R* result = result_buffer.data();
+
+  auto e = policy.get_queue().submit([&](sycl::handler& h) {
+    h.depends_on(policy.get_dependencies());
+    h.single_task([=]() {
+      auto load = [=](std::size_t k) { return data[k]; };
+      *result = finish(search_bound(load, 0, n, value, before));
+    });
+  });
+
+  return complete_value<R>(policy, e, result, std::move(result_buffer));
+}
+
+// Search for every value in `values` and call `store(i, value, index)` with
+// the index of its bound.  Each work-group first copies evenly spaced
+// splitters of the sorted range into local memory, which together stand in
+// for the top levels of the search tree.  Every query is narrowed to the
+// interval between two splitters in local memory, and only the final
+// log(n / wg_size) steps read global memory.  The grid is sized to fill the
+// device once, so the splitters are loaded once per work-group rather than
+// once per query.
+template <typename ExecutionPolicy, typename Iter, typename ValueIter,
+          typename Before, typename Store>
+sycl::event search_many(ExecutionPolicy&& policy, Iter first, std::size_t n,
+                        ValueIter values, std::size_t m, Before before,
+                        Store store) {
+  using T = std::iter_value_t<Iter>;
+  using U = std::iter_value_t<ValueIter>;
+
+  sycl::queue& q = policy.get_queue();
+  std::size_t wg_size = work_group_size(q);
+  std::size_t num_groups = num_work_groups(q, m, wg_size);
+  std::size_t num_splitters = std::min(wg_size, n);
+
+  return q.submit([&](sycl::handler& h) {
+    h.depends_on(policy.get_dependencies());
+    sycl::local_accessor<T, 1> splitters(wg_size, h);
+
+    // Splitter s is element (s + 1) * n / (num_splitters + 1).
+    auto position = [=](std::size_t s) {
+      return (s + 1) * n / (num_splitters + 1);
+    };
+
+    h.parallel_for(
+        sycl::nd_range<1>(num_groups * wg_size, wg_size),
+        [=](sycl::nd_item<1> item) {
+          std::size_t lid = item.get_local_id(0);
+          if (lid < num_splitters) {
+            splitters[lid] = T(kernel_reference(first, position(lid)));
+          }
+          sycl::group_barrier(item.get_group());
+
+          auto load_splitter = [&](std::size_t s) { return splitters[s]; };
+          auto load = [&](std::size_t k) {
+            return T(kernel_reference(first, k));
+          };
+
+          std::size_t stride = item.get_global_range(0);
+          for (std::size_t i = item.get_global_id(0); i < m; i += stride) {
+            U value(kernel_reference(values, i));
+
+            std::size_t s = search_bound(load_splitter, 0, num_splitters,
+                                         value, before);
+            std::size_t lo = s == 0 ? 0 : position(s - 1) + 1;
+            std::size_t hi = s == num_splitters ? n : position(s);
+
+            store(i, value, search_bound(load, lo, hi, value, before));
+          }
+        });
+  });
+}
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <cstddef>
+#include <utility>
+
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/scan.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+#include <thrust/device_ptr.h>
+
+namespace thrust {
+
+namespace __detail {
+
+// Element of a selection scan.  After scanning with `count_op`, `count` is
+// the number of selected elements up to and including this one.
+template <typename V>
+struct counted_value {
+  std::size_t count;
+  V value;
+};
+
+struct count_op {
+  template <typename V>
+  counted_value<V> operator()(const counted_value<V>& a,
+                              const counted_value<V>& b) const {
+    return {a.count + b.count, b.value};
+  }
+};
+
+// Summary of a range for `unique`: the number of runs of equivalent elements
+// in it, and its first and last elements.  A one-element range is one run.
+template <typename V>
+struct run_count {
+  std::size_t count;
+  V first;
+  V value;
+};
+
+template <typename BinaryPredicate>
+struct run_count_op {
+  BinaryPredicate pred;
+
+  template <typename V>
+  run_count<V> operator()(const run_count<V>& a, const run_count<V>& b) const {
+    return {a.count + b.count - (pred(a.value, b.first) ? 1 : 0), a.first,
+            b.value};
+  }
+};
+
+// Stream compaction as one fused predicate, scan and scatter pass.  `load(i)`
+// returns element i as a `counted_value` or `run_count` whose count, once
+// scanned with `op`, is the number of elements selected up to and including
+// i.  Selected elements are passed to `selected(k, value)` and the others to
+// `rejected(k, value)`, where k is the element's position among the selected
+// or rejected elements respectively.  Since `submit_scan` loads elements
+// before anything can overwrite them, the output may alias the input.
+//
+// `after(e, end)` may submit more work that depends on the scan; `end` holds
+// `result + count` on the device.  The result is `result + count`, returned
+// as a `future` under `par_nowait`.
+template <typename ExecutionPolicy, typename Load, typename Op,
+          typename Selected, typename Rejected, typename U, typename After,
+          typename... Resources>
+auto compact_impl(ExecutionPolicy&& policy, std::size_t n, Load load, Op op,
+                  Selected selected, Rejected rejected, device_ptr<U> result,
+                  After after, Resources&&... resources) {
+  if (n == 0) {
+    sycl::event::wait(policy.get_dependencies());
+    return ready_value(policy, result);
+  }
+
+  temporary_buffer<device_ptr<U>> end_buffer(policy, 1);
+  device_ptr<U>* end = end_buffer.data();
+  U* out = result.get();
+
+  auto [e, storage] = submit_scan(
+      policy, n, load, op,
+      [=](std::size_t i, const auto& incl, bool has_prev, const auto& prev) {
+        std::size_t before = has_prev ? prev.count : 0;
+        if (incl.count != before) {
+          selected(before, incl.value);
+        } else {
+          rejected(i - before, incl.value);
+        }
+        if (i == n - 1) {
+          *end = device_ptr<U>(out + incl.count);
+        }
+      });
+
+  sycl::event done = after(e, end);
+  return complete_value<device_ptr<U>>(policy, done, end, std::move(end_buffer),
+                                       std::move(storage),
+                                       std::forward<Resources>(resources)...);
+}
+
+template <typename ExecutionPolicy, typename Load, typename Op,
+          typename Selected, typename U>
+auto compact_impl(ExecutionPolicy&& policy, std::size_t n, Load load, Op op,
+                  Selected selected, device_ptr<U> result) {
+  return compact_impl(
+      policy, n, load, op, selected, [](std::size_t, const auto&) {}, result,
+      [](sycl::event e, const device_ptr<U>*) { return e; });
+}
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/temporary_resource.hpp>
+
+namespace thrust {
+
+struct caching_allocator_stats {
+  // Allocations served from a cached block.
+  std::size_t hits = 0;
+  // Allocations that had to call into the SYCL runtime.
+  std::size_t misses = 0;
+  // Bytes held in free blocks, waiting to be reused.
+  std::size_t bytes_cached = 0;
+  // Bytes handed out and not yet returned.
+  std::size_t bytes_in_use = 0;
+};
+
+namespace __detail {
+
+// Size-class pool of USM allocations of one kind (device by default, or
+// pinned host) for one (context, device) pair.  Requests are rounded up to a
+// power of two between 2^min_bin and 2^max_bin bytes, and freed blocks are
+// kept on a per-bin free list until the cached total would exceed
+// `max_cached_bytes`.  Larger requests bypass the bins.
+class device_memory_pool final : public temporary_resource {
+public:
+  static constexpr std::size_t min_bin = 8;
+  static constexpr std::size_t max_bin = 31;
+  static constexpr std::size_t default_max_cached_bytes = std::size_t(1) << 30;
+
+  device_memory_pool(const sycl::context& context, const sycl::device& device,
+                     sycl::usm::alloc kind = sycl::usm::alloc::device)
+      : context_(context), device_(device), kind_(kind),
+        free_blocks_(max_bin + 1) {}
+
+  device_memory_pool(const device_memory_pool&) = delete;
+  device_memory_pool& operator=(const device_memory_pool&) = delete;
+
+  ~device_memory_pool() {
+    release();
+  }
+
+  // Shared pool for the given context, device and allocation kind.
+  static std::shared_ptr<device_memory_pool>
+  get(const sycl::context& context, const sycl::device& device,
+      sycl::usm::alloc kind = sycl::usm::alloc::device) {
+    static pool_set pools;
+    return pools.get(context, device, kind);
+  }
+
+  void* allocate(std::size_t bytes) override {
+    if (bytes == 0) {
+      return nullptr;
+    }
+
+    std::size_t bin = bin_for_(bytes);
+    std::size_t block_bytes = bin_bytes_(bin, bytes);
+
+    {
+      std::lock_guard lock(mutex_);
+      if (bin != unbinned && !free_blocks_[bin].empty()) {
+        void* ptr = free_blocks_[bin].back();
+        free_blocks_[bin].pop_back();
+        stats_.hits++;
+        stats_.bytes_cached -= block_bytes;
+        stats_.bytes_in_use += block_bytes;
+        return ptr;
+      }
+      stats_.misses++;
+    }
+
+    void* ptr = sycl::malloc(block_bytes, device_, context_, kind_);
+
+    if (ptr == nullptr) {
+      // Give back everything we are holding on to and try once more.
+      release();
+      ptr = sycl::malloc(block_bytes, device_, context_, kind_);
+      if (ptr == nullptr) {
+        throw std::bad_alloc();
+      }
+    }
+
+    pointer_registry::instance().register_allocation(ptr, block_bytes, device_,
+                                                     context_);
+
+    std::lock_guard lock(mutex_);
+    stats_.bytes_in_use += block_bytes;
+    return ptr;
+  }
+
+  void deallocate(void* ptr, std::size_t bytes) override {
+    if (ptr == nullptr) {
+      return;
+    }
+
+    std::size_t bin = bin_for_(bytes);
+    std::size_t block_bytes = bin_bytes_(bin, bytes);
+
+    {
+      std::lock_guard lock(mutex_);
+      stats_.bytes_in_use -= block_bytes;
+      if (bin != unbinned &&
+          stats_.bytes_cached + block_bytes <= max_cached_bytes_) {
+        free_blocks_[bin].push_back(ptr);
+        stats_.bytes_cached += block_bytes;
+        return;
+      }
+    }
+
+    free_(ptr);
+  }
+
+  // Free cached blocks, largest first, until at most `target_bytes` remain.
+  void trim(std::size_t target_bytes) {
+    std::vector<void*> evicted;
+
+    {
+      std::lock_guard lock(mutex_);
+      for (std::size_t bin = max_bin + 1;
+           bin-- > min_bin && stats_.bytes_cached > target_bytes;) {
+        auto&& blocks = free_blocks_[bin];
+        while (!blocks.empty() && stats_.bytes_cached > target_bytes) {
+          evicted.push_back(blocks.back());
+          blocks.pop_back();
+          stats_.bytes_cached -= std::size_t(1) << bin;
+        }
+      }
+    }
+
+    for (void* ptr : evicted) {
+      free_(ptr);
+    }
+  }
+
+  // Free every cached block.
+  void release() {
+    trim(0);
+  }
+
+  void set_max_cached_bytes(std::size_t max_cached_bytes) {
+    {
+      std::lock_guard lock(mutex_);
+      max_cached_bytes_ = max_cached_bytes;
+    }
+    trim(max_cached_bytes);
+  }
+
+  std::size_t max_cached_bytes() const {
+    std::lock_guard lock(mutex_);
+    return max_cached_bytes_;
+  }
+
+  caching_allocator_stats stats() const {
+    std::lock_guard lock(mutex_);
+    return stats_;
+  }
+
+  sycl::context get_context() const noexcept {
+    return context_;
+  }
+
+  sycl::device get_device() const noexcept {
+    return device_;
+  }
+
+  sycl::usm::alloc get_kind() const noexcept {
+    return kind_;
+  }
+
+private:
+  static constexpr std::size_t unbinned =
+      std::numeric_limits<std::size_t>::max();
+
+  static std::size_t bin_for_(std::size_t bytes) {
+    std::size_t bin = std::bit_width(bytes - 1);
+    if (bin > max_bin) {
+      return unbinned;
+    }
+    return bin < min_bin ? min_bin : bin;
+  }
+
+  static std::size_t bin_bytes_(std::size_t bin, std::size_t bytes) {
+    return bin == unbinned ? bytes : std::size_t(1) << bin;
+  }
+
+  void free_(void* ptr) {
+    pointer_registry::instance().unregister_allocation(ptr);
+    sycl::free(ptr, context_);
+  }
+
+  class pool_set {
+  public:
+    // The registry must outlive the pools, which unregister their blocks
+    // when they are destroyed at exit.
+    pool_set() {
+      pointer_registry::instance();
+    }
+
+    std::shared_ptr<device_memory_pool> get(const sycl::context& context,
+                                            const sycl::device& device,
+                                            sycl::usm::alloc kind) {
+      std::lock_guard lock(mutex_);
+      for (auto&& pool : pools_) {
+        if (pool->get_context() == context && pool->get_device() == device &&
+            pool->get_kind() == kind) {
+          return pool;
+        }
+      }
+      return pools_.emplace_back(
+          std::make_shared<device_memory_pool>(context, device, kind));
+    }
+
+  private:
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<device_memory_pool>> pools_;
+  };
+
+  sycl::context context_;
+  sycl::device device_;
+  sycl::usm::alloc kind_;
+
+  mutable std::mutex mutex_;
+  std::vector<std::vector<void*>> free_blocks_;
+  std::size_t max_cached_bytes_ = default_max_cached_bytes;
+  caching_allocator_stats stats_;
+};
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include <thrust/detail/kernel_config.hpp>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+namespace __detail {
+
+inline constexpr std::size_t vector_bytes = 16;
+
+// Elements of T moved by one vector access, or 1 if sycl::vec cannot hold T.
+template <typename T>
+inline constexpr std::size_t vector_width_v =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+            sizeof(T) <= vector_bytes / 2
+        ? vector_bytes / sizeof(T)
+        : 1;
+
+template <std::size_t Width, typename T>
+bool is_vector_aligned(const T* ptr) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % (Width * sizeof(T)) == 0;
+}
+
+template <typename T>
+auto global_ptr(T* ptr) {
+  return sycl::address_space_cast<sycl::access::address_space::global_space,
+                                  sycl::access::decorated::no>(ptr);
+}
+
+// Load the v-th N-element vector starting at `ptr`.
+template <int N, typename T>
+sycl::vec<T, N> load_vector(const T* ptr, std::size_t v) {
+  sycl::vec<T, N> result;
+  result.load(v, global_ptr(ptr));
+  return result;
+}
+
+// Reference to element i of `iter` as seen from a kernel.  Elements of a
+// `device_ptr` are accessed directly rather than through `device_reference`.
+template <typename Iter>
+decltype(auto) kernel_reference(const Iter& iter, std::size_t i) {
+  if constexpr (is_device_ptr_v<Iter>) {
+    return iter.get()[i];
+  } else {
+    return iter[i];
+  }
+}
+
+// Call `f(i)` for every i in [0, n) from a grid-stride kernel.  The grid is
+// sized to fill the device once, so very long ranges are covered by each
+// work-item looping rather than by launching more work-groups.
+template <typename ExecutionPolicy, typename F>
+sycl::event for_each_index(ExecutionPolicy&& policy, std::size_t n, F f) {
+  sycl::queue& q = policy.get_queue();
+  std::size_t wg_size = work_group_size(q);
+  std::size_t num_groups = num_work_groups(q, n, wg_size);
+
+  return q.submit([&](sycl::handler& h) {
+    h.depends_on(policy.get_dependencies());
+
+    h.parallel_for(sycl::nd_range<1>(num_groups * wg_size, wg_size),
+                   [=](sycl::nd_item<1> item) {
+                     std::size_t stride = item.get_global_range(0);
+                     for (std::size_t i = item.get_global_id(0); i < n;
+                          i += stride) {
+                       f(i);
+                     }
+                   });
+  });
+}
+
+// out[i] = op(in[i]...) for i in [0, n).  When every element type fits in a
+// sycl::vec and every pointer is aligned to the vector size, each work-item
+// loads and stores whole 16-byte vectors, and the remaining tail elements
+// are handled one at a time.
+template <typename ExecutionPolicy, typename Op, typename U, typename... T>
+sycl::event vectorized_transform(ExecutionPolicy&& policy, std::size_t n,
+                                 Op op, U* out, const T*... in) {
+  constexpr std::size_t width =
+      std::min({vector_width_v<U>, vector_width_v<T>...});
+
+  if constexpr (width > 1) {
+    if (is_vector_aligned<width>(out) &&
+        (is_vector_aligned<width>(in) && ...)) {
+      constexpr int N = static_cast<int>(width);
+      std::size_t num_vectors = n / width;
+      std::size_t tail_first = num_vectors * width;
+
+      return for_each_index(
+          policy, num_vectors + (n - tail_first), [=](std::size_t v) {
+            if (v < num_vectors) {
+              auto inputs = std::make_tuple(load_vector<N>(in, v)...);
+              sycl::vec<U, N> result;
+              for (int k = 0; k < N; k++) {
+                result[k] = std::apply(
+                    [&](const auto&... x) { return op(x[k]...); }, inputs);
+              }
+              result.store(v, global_ptr(out));
+            } else {
+              std::size_t i = tail_first + (v - num_vectors);
+              out[i] = op(in[i]...);
+            }
+          });
+    }
+  }
+
+  return for_each_index(policy, n,
+                        [=](std::size_t i) { out[i] = op(in[i]...); });
+}
+
+} // namespace __detail
+
+} // namespace thrust
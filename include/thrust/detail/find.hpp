@@ -0,0 +1,216 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/kernel_config.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+#include <thrust/execution_policy.h>
+#include <thrust/profiling.h>
+
+namespace thrust {
+
+namespace __detail {
+
+// Consecutive elements each work-item tests between polls of the match index.
+inline constexpr std::size_t find_items_per_work_item = 8;
+
+// Elements of a host range compared per transfer by the host/device
+// `mismatch`.
+inline constexpr std::size_t mismatch_chunk_size = std::size_t(1) << 20;
+
+using find_index_ref =
+    sycl::atomic_ref<std::size_t, sycl::memory_order::relaxed,
+                     sycl::memory_scope::device,
+                     sycl::access::address_space::global_space>;
+
+// Submit a search of [0, n), n > 0, for the first i for which `pred(i)`
+// holds, leaving that i, or n if there is none, in `*found` and `finish(i)`
+// in `*result`.
+//
+// The grid sweeps the range from the front, each pass covering one block of
+// consecutive elements per work-item.  A match lowers a shared index with an
+// atomic minimum, and every work-item polls that index before each block, so
+// once a match is found no work-item starts a block past it and the kernel
+// finishes after at most one more pass.
+template <typename R, typename Predicate, typename Finish>
+sycl::event submit_find_first(sycl::queue& q,
+                              const std::vector<sycl::event>& dependencies,
+                              std::size_t n, Predicate pred, Finish finish,
+                              std::size_t* found, R* result) {
+  constexpr std::size_t items = find_items_per_work_item;
+
+  std::size_t wg_size = work_group_size(q);
+  std::size_t num_blocks = ceil_div(n, items);
+  std::size_t num_groups = num_work_groups(q, num_blocks, wg_size);
+
+  auto init_event = q.fill(found, n, 1, dependencies);
+
+  auto search_event = q.submit([&](sycl::handler& h) {
+    h.depends_on(init_event);
+    h.parallel_for(sycl::nd_range<1>(num_groups * wg_size, wg_size),
+                   [=](sycl::nd_item<1> item) {
+                     find_index_ref found_ref(*found);
+                     std::size_t stride = item.get_global_range(0);
+
+                     for (std::size_t b = item.get_global_id(0);
+                          b < num_blocks; b += stride) {
+                       std::size_t first = b * items;
+                       if (found_ref.load() <= first) {
+                         return;
+                       }
+                       std::size_t last = std::min(first + items, n);
+                       for (std::size_t i = first; i < last; i++) {
+                         if (pred(i)) {
+                           found_ref.fetch_min(i);
+                           return;
+                         }
+                       }
+                     }
+                   });
+  });
+
+  return q.submit([&](sycl::handler& h) {
+    h.depends_on(search_event);
+    h.single_task([=]() { *result = finish(*found); });
+  });
+}
+
+// Find the first i in [0, n) for which `pred(i)` holds, or n if there is
+// none, and return `finish(i)`, as a `future` under `par_nowait`.
+// `finish(n)` must be safe to call on the host when n is 0.
+template <typename R, typename ExecutionPolicy, typename Predicate,
+          typename Finish>
+auto find_first(ExecutionPolicy&& policy, std::size_t n, Predicate pred,
+                Finish finish) {
+  if (n == 0) {
+    sycl::event::wait(policy.get_dependencies());
+    return ready_value(policy, R(finish(0)));
+  }
+
+  temporary_buffer<std::size_t> found_buffer(policy, 1);
+  temporary_buffer<R> result_buffer(policy, 1);
+
+  auto e = submit_find_first(policy.get_queue(), policy.get_dependencies(), n,
+                             pred, finish, found_buffer.data(),
+                             result_buffer.data());
+
+  return complete_value<R>(policy, e, result_buffer.data(),
+                           std::move(found_buffer), std::move(result_buffer));
+}
+
+// Index of the first position at which the host range host[0, n) and the
+// device range `device` disagree, where `match(h, d)` compares an element
+// of each.  Host memory the device can access is read directly.  Otherwise
+// the host range is packed into pinned memory, once the policy's
+// dependencies have completed, and copied over in chunks on a second queue,
+// so the copy of each chunk runs while the one before is searched on the
+// policy's queue, and the search stops at the first chunk holding a
+// mismatch.  Blocks until the result is known.
+template <typename ExecutionPolicy, typename T, typename Iter, typename Match>
+std::size_t mismatch_host_device(ExecutionPolicy&& policy, const T* host,
+                                 Iter device, std::size_t n, Match match) {
+  sycl::queue& q = policy.get_queue();
+
+  if (n == 0) {
+    sycl::event::wait(policy.get_dependencies());
+    profile_completion(policy, nullptr);
+    return 0;
+  }
+
+  temporary_buffer<std::size_t> found(policy, 1);
+  temporary_buffer<std::size_t> result(policy, 1);
+
+  // Search data[0, count), which holds the host elements from `offset` on,
+  // after `dependencies`.
+  auto search = [&](const std::vector<sycl::event>& dependencies,
+                    const T* data, std::size_t offset, std::size_t count) {
+    return submit_find_first(
+        q, dependencies, count,
+        [=](std::size_t i) {
+          return !match(data[i], kernel_reference(device, offset + i));
+        },
+        [](std::size_t i) { return i; }, found.data(), result.data());
+  };
+
+  // The index of the first mismatch found by a search, or its `count`.  The
+  // last read back is the call's last command.
+  sycl::event read;
+  auto read_result = [&](sycl::event searched) {
+    std::size_t i;
+    read = q.memcpy(&i, result.data(), sizeof(std::size_t), searched);
+    profile_transfer(policy, transfer_direction::device_to_host,
+                     sizeof(std::size_t));
+    read.wait();
+    return i;
+  };
+
+  if (is_device_accessible(host, q.get_context())) {
+    std::size_t i = read_result(search(policy.get_dependencies(), host, 0, n));
+    profile_completion(policy, &read);
+    return i;
+  }
+
+  std::size_t chunk = std::min(n, mismatch_chunk_size);
+  std::size_t second = n > chunk ? chunk : 0;
+  staging_buffer<T> staging[2] = {staging_buffer<T>(policy, chunk),
+                                  staging_buffer<T>(policy, second)};
+  temporary_buffer<T> buffers[2] = {temporary_buffer<T>(policy, chunk),
+                                    temporary_buffer<T>(policy, second)};
+
+  // Copies go through a queue of their own, so that however the policy's
+  // queue orders its commands, no search waits behind the copy of the chunk
+  // after it.
+  sycl::queue copy_queue = pointer_registry::instance().get_copy_queue(
+      q.get_context(), q.get_device());
+
+  // Both buffers for chunk k were last used by chunk k - 2, whose copy and
+  // search have completed.
+  auto copy_chunk = [&](std::size_t k) {
+    std::size_t offset = k * chunk;
+    std::size_t count = std::min(chunk, n - offset);
+    std::memcpy(staging[k % 2].data(), host + offset, count * sizeof(T));
+    profile_transfer(policy, transfer_direction::host_to_device,
+                     count * sizeof(T));
+    return copy_queue.memcpy(buffers[k % 2].data(), staging[k % 2].data(),
+                             count * sizeof(T));
+  };
+
+  // The dependencies may still be writing either range.
+  sycl::event::wait(policy.get_dependencies());
+
+  sycl::event copied = copy_chunk(0);
+  for (std::size_t k = 0;; k++) {
+    std::size_t offset = k * chunk;
+    std::size_t count = std::min(chunk, n - offset);
+    bool last = offset + chunk >= n;
+
+    auto searched = search({copied}, buffers[k % 2].data(), offset, count);
+
+    sycl::event next_copied;
+    if (!last) {
+      next_copied = copy_chunk(k + 1);
+    }
+
+    std::size_t i = read_result(searched);
+    if (i < count || last) {
+      // The buffers must not be released while a copy still writes them.
+      next_copied.wait();
+      profile_completion(policy, &read);
+      return offset + i;
+    }
+    copied = next_copied;
+  }
+}
+
+} // namespace __detail
+
+} // namespace thrust
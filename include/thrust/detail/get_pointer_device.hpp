@@ -1,32 +1,199 @@
 #pragma once
 
 #include <sycl/sycl.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <thrust/detail/default_selector.hpp>
+#include <thrust/detail/profiling_counters.hpp>
 
 namespace thrust {
 
 namespace __detail {
 
-inline std::vector<sycl::context> global_contexts_;
+// Process-wide record of the USM allocations made by sycl-thrust allocators,
+// plus long-lived in-order queues per (context, device) pair.  Pointer
+// lookups are an interval search under a shared lock, so resolving the owner
+// of a pointer never needs to probe contexts or construct queues.
+class pointer_registry {
+public:
+  static pointer_registry& instance() {
+    static pointer_registry registry;
+    return registry;
+  }
 
-template <typename T>
-std::pair<sycl::device, sycl::context> get_pointer_device(T* ptr) {
-  if (global_contexts_.empty()) {
-    for (auto&& platform : sycl::platform::get_platforms()) {
-      sycl::context context(platform.get_devices());
+  void register_allocation(const void* ptr, std::size_t bytes,
+                           const sycl::device& device,
+                           const sycl::context& context) {
+    if (ptr == nullptr) {
+      return;
+    }
+    std::unique_lock lock(allocations_mutex_);
+    allocations_.insert_or_assign(address_(ptr),
+                                  allocation{bytes, device, context});
+  }
 
-      global_contexts_.push_back(context);
+  void unregister_allocation(const void* ptr) {
+    std::unique_lock lock(allocations_mutex_);
+    allocations_.erase(address_(ptr));
+  }
+
+  std::optional<std::pair<sycl::device, sycl::context>>
+  find(const void* ptr) const {
+    std::uintptr_t address = address_(ptr);
+
+    std::shared_lock lock(allocations_mutex_);
+    auto iter = allocations_.upper_bound(address);
+    if (iter == allocations_.begin()) {
+      return std::nullopt;
+    }
+    --iter;
+
+    // Also accept the one-past-the-end address, which is a valid `last`.
+    if (address - iter->first > iter->second.bytes) {
+      return std::nullopt;
     }
+    return std::pair{iter->second.device, iter->second.context};
+  }
+
+  sycl::queue get_queue(const sycl::context& context,
+                        const sycl::device& device) {
+    return get_or_create_queue_(queues_, context, device, true);
   }
 
-  for (auto&& context : global_contexts_) {
-    try {
-      sycl::device device = sycl::get_pointer_device(ptr, context);
-      return {device, context};
-    } catch (...) {
+  // A second long-lived in-order queue per (context, device) pair, for
+  // transfers meant to run alongside work on any other queue.  It is not
+  // counted as an implicit queue creation.
+  sycl::queue get_copy_queue(const sycl::context& context,
+                             const sycl::device& device) {
+    return get_or_create_queue_(copy_queues_, context, device, false);
+  }
+
+  // Contexts probed for pointers that were not allocated through a
+  // sycl-thrust allocator.
+  const std::vector<sycl::context>& fallback_contexts() {
+    std::call_once(contexts_flag_, [this] {
+      for (auto&& platform : sycl::platform::get_platforms()) {
+#ifdef SYCL_EXT_ONEAPI_DEFAULT_CONTEXT
+        contexts_.push_back(platform.ext_oneapi_get_default_context());
+#endif
+        contexts_.push_back(sycl::context(platform.get_devices()));
+      }
+    });
+    return contexts_;
+  }
+
+  sycl::queue fallback_queue() {
+    std::call_once(fallback_queue_flag_, [this] {
+      ++profiling_counters::instance().implicit_queue_creations;
+      fallback_queue_.emplace(sycl::cpu_selector_v,
+                              sycl::property::queue::in_order());
+    });
+    return *fallback_queue_;
+  }
+
+private:
+  pointer_registry() = default;
+
+  struct allocation {
+    std::size_t bytes;
+    sycl::device device;
+    sycl::context context;
+  };
+
+  struct queue_key {
+    sycl::context context;
+    sycl::device device;
+
+    bool operator==(const queue_key&) const = default;
+  };
+
+  struct queue_key_hash {
+    std::size_t operator()(const queue_key& key) const {
+      std::size_t h = std::hash<sycl::context>{}(key.context);
+      return h ^ (std::hash<sycl::device>{}(key.device) + 0x9e3779b9 +
+                  (h << 6) + (h >> 2));
     }
+  };
+
+  using queue_map = std::unordered_map<queue_key, sycl::queue, queue_key_hash>;
+
+  sycl::queue get_or_create_queue_(queue_map& queues,
+                                   const sycl::context& context,
+                                   const sycl::device& device, bool implicit) {
+    queue_key key{context, device};
+
+    {
+      std::shared_lock lock(queues_mutex_);
+      auto iter = queues.find(key);
+      if (iter != queues.end()) {
+        return iter->second;
+      }
+    }
+
+    std::unique_lock lock(queues_mutex_);
+    auto iter = queues.find(key);
+    if (iter == queues.end()) {
+      if (implicit) {
+        ++profiling_counters::instance().implicit_queue_creations;
+      }
+      iter = queues
+                 .emplace(key, sycl::queue(context, device,
+                                           sycl::property::queue::in_order()))
+                 .first;
+    }
+    return iter->second;
+  }
+
+  static std::uintptr_t address_(const void* ptr) {
+    return reinterpret_cast<std::uintptr_t>(ptr);
+  }
+
+  mutable std::shared_mutex allocations_mutex_;
+  std::map<std::uintptr_t, allocation> allocations_;
+
+  std::shared_mutex queues_mutex_;
+  queue_map queues_;
+  queue_map copy_queues_;
+
+  std::once_flag contexts_flag_;
+  std::vector<sycl::context> contexts_;
+
+  std::once_flag fallback_queue_flag_;
+  std::optional<sycl::queue> fallback_queue_;
+};
+
+template <typename T>
+std::optional<std::pair<sycl::device, sycl::context>>
+find_pointer_device(T* ptr) {
+  auto&& registry = pointer_registry::instance();
+
+  if (auto owner = registry.find(ptr)) {
+    return owner;
+  }
+
+  for (auto&& context : registry.fallback_contexts()) {
+    if (sycl::get_pointer_type(ptr, context) != sycl::usm::alloc::unknown) {
+      return std::pair{sycl::get_pointer_device(ptr, context), context};
+    }
+  }
+
+  return std::nullopt;
+}
+
+template <typename T>
+std::pair<sycl::device, sycl::context> get_pointer_device(T* ptr) {
+  if (auto owner = find_pointer_device(ptr)) {
+    return *owner;
   }
 
   throw std::runtime_error(
@@ -35,12 +202,21 @@ std::pair<sycl::device, sycl::context> get_pointer_device(T* ptr) {
 
 template <typename T>
 sycl::queue get_pointer_queue(T* ptr) {
-  try {
-    auto&& [device, context] = get_pointer_device(ptr);
-    return sycl::queue(context, device);
-  } catch (...) {
-    return sycl::queue(sycl::cpu_selector_v);
+  auto&& registry = pointer_registry::instance();
+
+  if (auto owner = find_pointer_device(ptr)) {
+    auto&& [device, context] = *owner;
+    return registry.get_queue(context, device);
   }
+  return registry.fallback_queue();
+}
+
+// Whether `ptr` points into host memory that devices in `context` can
+// access directly, i.e. pinned host or shared USM.
+inline bool is_device_accessible(const void* ptr,
+                                 const sycl::context& context) {
+  auto kind = sycl::get_pointer_type(ptr, context);
+  return kind == sycl::usm::alloc::host || kind == sycl::usm::alloc::shared;
 }
 
 } // namespace __detail
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+
+namespace thrust {
+
+namespace __detail {
+
+// Tree reduction across a work-group through local memory.  Only the first
+// `count` work-items contribute `value`, which lets callers reduce ragged
+// tiles without an identity element.  The work-group size must be a power of
+// two no larger than `scratch`, and every work-item must call this.  The
+// reduced value is returned to all work-items.
+template <typename T, typename BinaryOp>
+T group_reduce(sycl::nd_item<1> item, const sycl::local_accessor<T, 1>& scratch,
+               const T& value, std::size_t count, BinaryOp op) {
+  std::size_t lid = item.get_local_id(0);
+
+  if (lid < count) {
+    scratch[lid] = value;
+  }
+
+  for (std::size_t stride = item.get_local_range(0) / 2; stride > 0;
+       stride /= 2) {
+    sycl::group_barrier(item.get_group());
+    if (lid < stride && lid + stride < count) {
+      scratch[lid] = op(scratch[lid], scratch[lid + stride]);
+    }
+  }
+
+  sycl::group_barrier(item.get_group());
+  T result = scratch[0];
+  sycl::group_barrier(item.get_group());
+  return result;
+}
+
+// Tree reduction across a sub-group through shuffles.  As with
+// `group_reduce`, only the first `count` work-items contribute `value`.  The
+// reduced value is returned to work-item 0 of the sub-group.
+template <typename T, typename BinaryOp>
+T sub_group_reduce(const sycl::sub_group& sg, T value, std::size_t count,
+                   BinaryOp op) {
+  std::size_t lid = sg.get_local_linear_id();
+
+  for (std::size_t offset = std::bit_ceil(sg.get_local_linear_range()) / 2;
+       offset > 0; offset /= 2) {
+    T other = sycl::shift_group_left(sg, value, offset);
+    if (lid + offset < count) {
+      value = op(value, other);
+    }
+    count = std::min(count, offset);
+  }
+  return value;
+}
+
+} // namespace __detail
+
+} // namespace thrust
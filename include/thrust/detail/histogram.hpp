@@ -0,0 +1,195 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include <thrust/detail/binary_search.hpp>
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/kernel_config.hpp>
+
+namespace thrust {
+
+namespace __detail {
+
+// floor(a * b / c) for a < c, without overflowing 64 bits.  Products that
+// do not fit are formed one bit of b at a time, keeping the remainder
+// modulo c and counting the quotient alongside.
+inline std::uint64_t mul_div(std::uint64_t a, std::uint64_t b,
+                             std::uint64_t c) {
+  if (b == 0 || a <= std::numeric_limits<std::uint64_t>::max() / b) {
+    return a * b / c;
+  }
+
+  std::uint64_t q = 0;
+  std::uint64_t r = 0;
+  for (int bit = 63; bit >= 0; bit--) {
+    // Double (q, r), then add a if this bit of b is set, reducing r below c
+    // after each step.  r < c and a < c, so one subtraction suffices.
+    q *= 2;
+    if (r >= c - r) {
+      r -= c - r;
+      q++;
+    } else {
+      r *= 2;
+    }
+    if ((b >> bit) & 1) {
+      if (r >= c - a) {
+        r -= c - a;
+        q++;
+      } else {
+        r += a;
+      }
+    }
+  }
+  return q;
+}
+
+// Bin of a value among `num_bins` equal-width bins covering [lower, upper),
+// or `num_bins` if it falls outside them.
+template <typename T>
+struct even_bins {
+  T lower;
+  T upper;
+  std::size_t num_bins;
+
+  template <typename V>
+  std::size_t operator()(const V& value) const {
+    if (!(value >= lower && value < upper)) {
+      return num_bins;
+    }
+    if constexpr (std::is_integral_v<T>) {
+      // Offsets are taken in the unsigned type of T, where they cannot
+      // overflow however wide the range is.
+      using U = std::make_unsigned_t<T>;
+      std::uint64_t offset = U(U(T(value)) - U(lower));
+      std::uint64_t width = U(U(upper) - U(lower));
+      return mul_div(offset, num_bins, width);
+    } else {
+      // Rounding may land a value just below `upper` one bin too far.
+      std::size_t bin = (value - lower) / (upper - lower) * T(num_bins);
+      return bin < num_bins ? bin : num_bins - 1;
+    }
+  }
+};
+
+// Bin of a value given `num_bins + 1` ascending edges, where bin b covers
+// [edges[b], edges[b + 1]), or `num_bins` if it falls outside them.
+template <typename Iter>
+struct edge_bins {
+  Iter edges;
+  std::size_t num_bins;
+
+  template <typename V>
+  std::size_t operator()(const V& value) const {
+    using T = std::iter_value_t<Iter>;
+    auto load = [&](std::size_t k) { return T(kernel_reference(edges, k)); };
+
+    // Index of the first edge greater than `value`.
+    std::size_t k =
+        search_bound(load, 0, num_bins + 1, T(value),
+                     before_upper_bound<std::less<T>>{std::less<T>()});
+    return k == 0 || k > num_bins ? num_bins : k - 1;
+  }
+};
+
+// Count `num_histograms` histograms at once, where histogram h covers
+// first[h * ld + i] for i in [0, n) and its counts are written to
+// counts[h * num_bins, (h + 1) * num_bins).  `bin(value)` returns a value's
+// bin, or `num_bins` to skip it.
+//
+// When all the histograms fit in half of the device's local memory, each
+// work-group counts its share of the input in a private histogram with
+// local atomics, then adds each nonzero count to global memory once, so skew
+// towards a few bins only contends within a work-group.  Otherwise every
+// element is counted with a global atomic.
+template <typename ExecutionPolicy, typename Iter, typename C, typename Bin>
+sycl::event histogram_impl(ExecutionPolicy&& policy, Iter first, std::size_t n,
+                           std::size_t num_histograms, std::size_t ld,
+                           C* counts, std::size_t num_bins, Bin bin) {
+  using value_type = std::iter_value_t<Iter>;
+  using count_ref =
+      sycl::atomic_ref<C, sycl::memory_order::relaxed,
+                       sycl::memory_scope::device,
+                       sycl::access::address_space::global_space>;
+  using local_count_ref =
+      sycl::atomic_ref<std::uint32_t, sycl::memory_order::relaxed,
+                       sycl::memory_scope::work_group,
+                       sycl::access::address_space::local_space>;
+
+  sycl::queue& q = policy.get_queue();
+  std::size_t total_bins = num_histograms * num_bins;
+  std::size_t total = num_histograms * n;
+
+  auto e = q.fill(counts, C(0), total_bins, policy.get_dependencies());
+  if (total == 0 || num_bins == 0) {
+    return e;
+  }
+
+  std::size_t wg_size = work_group_size(q);
+  std::size_t num_groups = num_work_groups(q, total, wg_size);
+  std::size_t local_mem_size =
+      q.get_device().get_info<sycl::info::device::local_mem_size>();
+
+  // Bin of element g of the concatenated histograms' inputs.
+  auto bin_of = [=](std::size_t g) {
+    return bin(value_type(kernel_reference(first, g / n * ld + g % n)));
+  };
+
+  if (total_bins * sizeof(std::uint32_t) > local_mem_size / 2) {
+    return q.submit([&](sycl::handler& h) {
+      h.depends_on(e);
+      h.parallel_for(sycl::nd_range<1>(num_groups * wg_size, wg_size),
+                     [=](sycl::nd_item<1> item) {
+                       std::size_t stride = item.get_global_range(0);
+                       for (std::size_t g = item.get_global_id(0); g < total;
+                            g += stride) {
+                         std::size_t b = bin_of(g);
+                         if (b < num_bins) {
+                           count_ref(counts[g / n * num_bins + b])
+                               .fetch_add(C(1));
+                         }
+                       }
+                     });
+    });
+  }
+
+  return q.submit([&](sycl::handler& h) {
+    h.depends_on(e);
+    sycl::local_accessor<std::uint32_t, 1> local_counts(total_bins, h);
+
+    h.parallel_for(
+        sycl::nd_range<1>(num_groups * wg_size, wg_size),
+        [=](sycl::nd_item<1> item) {
+          std::size_t lid = item.get_local_id(0);
+          for (std::size_t k = lid; k < total_bins; k += wg_size) {
+            local_counts[k] = 0;
+          }
+          sycl::group_barrier(item.get_group());
+
+          std::size_t stride = item.get_global_range(0);
+          for (std::size_t g = item.get_global_id(0); g < total; g += stride) {
+            std::size_t b = bin_of(g);
+            if (b < num_bins) {
+              local_count_ref(local_counts[g / n * num_bins + b]).fetch_add(1);
+            }
+          }
+          sycl::group_barrier(item.get_group());
+
+          for (std::size_t k = lid; k < total_bins; k += wg_size) {
+            if (std::uint32_t count = local_counts[k]; count != 0) {
+              count_ref(counts[k]).fetch_add(C(count));
+            }
+          }
+        });
+  });
+}
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+
+namespace thrust {
+
+namespace __detail {
+
+// Grants `iterator_facade` access to the private core of an iterator.
+class iterator_core_access {
+public:
+  template <typename Iterator>
+  static constexpr decltype(auto) dereference(const Iterator& iter) {
+    return iter.dereference();
+  }
+
+  template <typename Iterator>
+  static constexpr void advance(Iterator& iter, std::ptrdiff_t n) {
+    iter.advance(n);
+  }
+
+  template <typename Iterator>
+  static constexpr std::ptrdiff_t distance_to(const Iterator& from,
+                                              const Iterator& to) {
+    return from.distance_to(to);
+  }
+};
+
+// Base for the fancy random access iterators.  `Derived` implements
+// `dereference()`, `advance(n)` and `distance_to(other)`, and the facade
+// supplies the arithmetic, comparisons and iterator traits.  Iterators built
+// on it are plain values, so they can be captured by SYCL kernels.
+template <typename Derived, typename Value, typename Reference = Value>
+class iterator_facade {
+public:
+  using value_type = Value;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = Reference;
+  using iterator_category = std::random_access_iterator_tag;
+
+  constexpr reference operator*() const {
+    return iterator_core_access::dereference(derived_());
+  }
+
+  constexpr reference operator[](difference_type n) const {
+    return *(derived_() + n);
+  }
+
+  constexpr Derived& operator++() {
+    iterator_core_access::advance(derived_(), 1);
+    return derived_();
+  }
+
+  constexpr Derived operator++(int) {
+    Derived other = derived_();
+    ++*this;
+    return other;
+  }
+
+  constexpr Derived& operator--() {
+    iterator_core_access::advance(derived_(), -1);
+    return derived_();
+  }
+
+  constexpr Derived operator--(int) {
+    Derived other = derived_();
+    --*this;
+    return other;
+  }
+
+  constexpr Derived& operator+=(difference_type n) {
+    iterator_core_access::advance(derived_(), n);
+    return derived_();
+  }
+
+  constexpr Derived& operator-=(difference_type n) {
+    iterator_core_access::advance(derived_(), -n);
+    return derived_();
+  }
+
+  friend constexpr Derived operator+(Derived iter, difference_type n) {
+    iterator_core_access::advance(iter, n);
+    return iter;
+  }
+
+  friend constexpr Derived operator+(difference_type n, Derived iter) {
+    iterator_core_access::advance(iter, n);
+    return iter;
+  }
+
+  friend constexpr Derived operator-(Derived iter, difference_type n) {
+    iterator_core_access::advance(iter, -n);
+    return iter;
+  }
+
+  friend constexpr difference_type operator-(const Derived& a,
+                                             const Derived& b) {
+    return iterator_core_access::distance_to(b, a);
+  }
+
+  friend constexpr bool operator==(const Derived& a, const Derived& b) {
+    return a - b == 0;
+  }
+
+  friend constexpr std::strong_ordering operator<=>(const Derived& a,
+                                                    const Derived& b) {
+    return a - b <=> 0;
+  }
+
+private:
+  constexpr Derived& derived_() {
+    return static_cast<Derived&>(*this);
+  }
+
+  constexpr const Derived& derived_() const {
+    return static_cast<const Derived&>(*this);
+  }
+};
+
+} // namespace __detail
+
+} // namespace thrust
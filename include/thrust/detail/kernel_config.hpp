@@ -0,0 +1,38 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+
+namespace thrust {
+
+namespace __detail {
+
+constexpr std::size_t ceil_div(std::size_t a, std::size_t b) {
+  return (a + b - 1) / b;
+}
+
+// Largest power-of-two work-group size supported by the queue's device, up
+// to `limit`.
+inline std::size_t work_group_size(const sycl::queue& q,
+                                   std::size_t limit = 256) {
+  std::size_t max_size =
+      q.get_device().get_info<sycl::info::device::max_work_group_size>();
+  return std::bit_floor(std::min(max_size, limit));
+}
+
+// Number of work-groups for a grid-stride kernel over `n` items: enough to
+// fill the device, but never more than there are work-group sized tiles.
+inline std::size_t num_work_groups(const sycl::queue& q, std::size_t n,
+                                   std::size_t wg_size) {
+  std::size_t compute_units =
+      q.get_device().get_info<sycl::info::device::max_compute_units>();
+  std::size_t max_groups = std::max<std::size_t>(compute_units * 8, 1);
+  return std::clamp<std::size_t>(ceil_div(n, wg_size), 1, max_groups);
+}
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <thrust/detail/binary_search.hpp>
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/kernel_config.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/scan.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+#include <thrust/device_ptr.h>
+
+namespace thrust {
+
+namespace __detail {
+
+// Number of merged elements each work-item produces.
+inline constexpr std::size_t merge_items_per_work_item = 8;
+
+// Number of elements of `a` among the first d elements of the stable merge
+// of a[0, na) and b[0, nb), in which elements of `a` come first on ties.
+template <typename Iter1, typename Iter2, typename Compare>
+std::size_t merge_path_split(Iter1 a, std::size_t na, Iter2 b, std::size_t nb,
+                             std::size_t d, Compare comp) {
+  using T1 = std::iter_value_t<Iter1>;
+  using T2 = std::iter_value_t<Iter2>;
+
+  std::size_t first = d > nb ? d - nb : 0;
+  std::size_t last = std::min(d, na);
+
+  while (first < last) {
+    std::size_t middle = first + (last - first) / 2;
+    if (comp(T2(kernel_reference(b, d - middle - 1)),
+             T1(kernel_reference(a, middle)))) {
+      last = middle;
+    } else {
+      first = middle + 1;
+    }
+  }
+  return first;
+}
+
+// Walk the stable merge of a[0, na) and b[0, nb) in parallel.  The merge path
+// is cut into equal pieces, whatever the distribution of the inputs, and each
+// work-item finds the start and end of its piece by binary search and then
+// merges it serially.  For the element at each step, `take_a(i, j)` or
+// `take_b(i, j)` is called with the position (i, j) the merge has reached,
+// so that element is a[i] or b[j] and its position in the merge is i + j.
+template <typename ExecutionPolicy, typename Iter1, typename Iter2,
+          typename Compare, typename TakeA, typename TakeB>
+sycl::event merge_path_walk(ExecutionPolicy&& policy, Iter1 a, std::size_t na,
+                            Iter2 b, std::size_t nb, Compare comp,
+                            TakeA take_a, TakeB take_b) {
+  using T1 = std::iter_value_t<Iter1>;
+  using T2 = std::iter_value_t<Iter2>;
+  constexpr std::size_t items = merge_items_per_work_item;
+
+  std::size_t n = na + nb;
+
+  return for_each_index(policy, ceil_div(n, items), [=](std::size_t p) {
+    std::size_t d = p * items;
+    std::size_t d_last = std::min(d + items, n);
+
+    std::size_t i = merge_path_split(a, na, b, nb, d, comp);
+    std::size_t j = d - i;
+
+    for (std::size_t k = d; k < d_last; k++) {
+      if (j == nb || (i < na && !comp(T2(kernel_reference(b, j)),
+                                      T1(kernel_reference(a, i))))) {
+        take_a(i, j);
+        i++;
+      } else {
+        take_b(i, j);
+        j++;
+      }
+    }
+  });
+}
+
+// Number of elements selected from each input of a set operation.
+struct selection_count {
+  std::size_t a;
+  std::size_t b;
+};
+
+struct selection_count_op {
+  selection_count operator()(const selection_count& x,
+                             const selection_count& y) const {
+    return {x.a + y.a, x.b + y.b};
+  }
+};
+
+// Selection for a range none of whose elements are kept.
+struct keep_none {
+  bool operator()(std::size_t, std::size_t) const {
+    return false;
+  }
+};
+
+// Set operations on sorted ranges with duplicates, as in the standard
+// library.  An element that is the r-th of its equivalent elements in its
+// own range, while the other range holds c equivalent elements, is kept by
+// `keep_a(r, c)` or `keep_b(r, c)`.  A first pass ranks every element of
+// both ranges with binary searches and scans the selections, so that the
+// kept elements of a[0, i) and b[0, j) number selected_a[i] and
+// selected_b[j].  A merge-path walk then writes every kept element straight
+// to its output position selected_a[i] + selected_b[j].
+//
+// Returns `result + count`, as a `future` under `par_nowait`.
+template <typename ExecutionPolicy, typename Iter1, typename Iter2,
+          typename U, typename Compare, typename KeepA, typename KeepB>
+auto set_operation_impl(ExecutionPolicy&& policy, Iter1 a, std::size_t na,
+                        Iter2 b, std::size_t nb, device_ptr<U> result,
+                        Compare comp, KeepA keep_a, KeepB keep_b) {
+  using T1 = std::iter_value_t<Iter1>;
+  using T2 = std::iter_value_t<Iter2>;
+
+  std::size_t n = na + nb;
+  if (n == 0) {
+    sycl::event::wait(policy.get_dependencies());
+    return ready_value(policy, result);
+  }
+
+  temporary_buffer<std::size_t> selected_buffer(policy, n + 2);
+  temporary_buffer<device_ptr<U>> end_buffer(policy, 1);
+  std::size_t* selected_a = selected_buffer.data();
+  std::size_t* selected_b = selected_a + na + 1;
+  device_ptr<U>* end = end_buffer.data();
+  U* out = result.get();
+
+  auto load_a = [=](std::size_t k) { return T1(kernel_reference(a, k)); };
+  auto load_b = [=](std::size_t k) { return T2(kernel_reference(b, k)); };
+
+  // Whether `keep_fn` keeps element k of one range, whose value is `value`,
+  // given its rank among its equivalents there and their number in the other.
+  auto keep = [=](auto keep_fn, auto load_own, std::size_t k, auto value,
+                  auto load_other, std::size_t n_other) {
+    before_lower_bound<Compare> before_lower{comp};
+    before_upper_bound<Compare> before_upper{comp};
+    std::size_t rank = k - search_bound(load_own, 0, k, value, before_lower);
+    std::size_t lower =
+        search_bound(load_other, 0, n_other, value, before_lower);
+    std::size_t upper =
+        search_bound(load_other, lower, n_other, value, before_upper);
+    return keep_fn(rank, upper - lower);
+  };
+
+  auto [scan_event, storage] = submit_scan(
+      policy, n,
+      [=](std::size_t k) {
+        if (k < na) {
+          bool kept = keep(keep_a, load_a, k, load_a(k), load_b, nb);
+          return selection_count{kept ? 1u : 0u, 0};
+        }
+        if constexpr (std::is_same_v<KeepB, keep_none>) {
+          return selection_count{0, 0};
+        } else {
+          std::size_t j = k - na;
+          bool kept = keep(keep_b, load_b, j, load_b(j), load_a, na);
+          return selection_count{0, kept ? 1u : 0u};
+        }
+      },
+      selection_count_op{},
+      [=](std::size_t k, const selection_count& incl, bool, const auto&) {
+        if (k == 0) {
+          selected_a[0] = 0;
+          selected_b[0] = 0;
+        }
+        if (k < na) {
+          selected_a[k + 1] = incl.a;
+        } else {
+          selected_b[k - na + 1] = incl.b;
+        }
+        if (k == n - 1) {
+          *end = device_ptr<U>(out + incl.a + incl.b);
+        }
+      });
+
+  auto e = merge_path_walk(
+      policy.after(scan_event), a, na, b, nb, comp,
+      [=](std::size_t i, std::size_t j) {
+        if (selected_a[i + 1] != selected_a[i]) {
+          out[selected_a[i] + selected_b[j]] = load_a(i);
+        }
+      },
+      [=](std::size_t i, std::size_t j) {
+        if (selected_b[j + 1] != selected_b[j]) {
+          out[selected_a[i] + selected_b[j]] = load_b(j);
+        }
+      });
+
+  return complete_value<device_ptr<U>>(policy, e, end, std::move(end_buffer),
+                                       std::move(selected_buffer),
+                                       std::move(storage));
+}
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <thrust/detail/kernel_config.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/radix_sort.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+
+namespace thrust {
+
+namespace __detail {
+
+inline constexpr std::size_t merge_sort_block_size = 8;
+
+// Stable bottom-up merge sort for keys that radix sort cannot handle.  Each
+// work-item first insertion sorts a small block, then every merge pass places
+// each element directly at its output position by binary searching the run
+// it is being merged with.
+template <typename ExecutionPolicy, typename T, typename V, typename Compare>
+auto merge_sort(ExecutionPolicy&& policy, T* keys, V* values, std::size_t n,
+                Compare comp) {
+  constexpr bool has_values = !std::is_same_v<V, no_value>;
+  constexpr std::size_t block_size = merge_sort_block_size;
+
+  sycl::queue& q = policy.get_queue();
+
+  temporary_buffer<T> keys_tmp(policy, n);
+  temporary_buffer<V> values_tmp(policy, has_values ? n : 0);
+
+  auto e = q.submit([&](sycl::handler& h) {
+    h.depends_on(policy.get_dependencies());
+
+    h.parallel_for(sycl::range<1>(ceil_div(n, block_size)),
+                   [=](sycl::id<1> id) {
+                     std::size_t first = id[0] * block_size;
+                     std::size_t last = std::min(first + block_size, n);
+
+                     for (std::size_t i = first + 1; i < last; i++) {
+                       T key = keys[i];
+                       std::size_t j = i;
+                       if constexpr (has_values) {
+                         V value = values[i];
+                         for (; j > first && comp(key, keys[j - 1]); j--) {
+                           keys[j] = keys[j - 1];
+                           values[j] = values[j - 1];
+                         }
+                         values[j] = value;
+                       } else {
+                         for (; j > first && comp(key, keys[j - 1]); j--) {
+                           keys[j] = keys[j - 1];
+                         }
+                       }
+                       keys[j] = key;
+                     }
+                   });
+  });
+
+  T* keys_in = keys;
+  T* keys_out = keys_tmp.data();
+  V* values_in = values;
+  V* values_out = values_tmp.data();
+
+  for (std::size_t width = block_size; width < n; width *= 2) {
+    e = q.submit([&](sycl::handler& h) {
+      h.depends_on(e);
+
+      h.parallel_for(sycl::range<1>(n), [=](sycl::id<1> id) {
+        std::size_t i = id[0];
+        std::size_t run = i / width;
+        std::size_t left_first = (run & ~std::size_t(1)) * width;
+        std::size_t middle = std::min(left_first + width, n);
+        std::size_t right_last = std::min(left_first + 2 * width, n);
+
+        T key = keys_in[i];
+        std::size_t position;
+
+        if (run % 2 == 0) {
+          // Elements of the left run go before equal elements on the right.
+          std::size_t lo = middle;
+          std::size_t hi = right_last;
+          while (lo < hi) {
+            std::size_t mid = lo + (hi - lo) / 2;
+            if (comp(keys_in[mid], key)) {
+              lo = mid + 1;
+            } else {
+              hi = mid;
+            }
+          }
+          position = i + (lo - middle);
+        } else {
+          std::size_t lo = left_first;
+          std::size_t hi = middle;
+          while (lo < hi) {
+            std::size_t mid = lo + (hi - lo) / 2;
+            if (!comp(key, keys_in[mid])) {
+              lo = mid + 1;
+            } else {
+              hi = mid;
+            }
+          }
+          position = left_first + (i - middle) + (lo - left_first);
+        }
+
+        keys_out[position] = key;
+        if constexpr (has_values) {
+          values_out[position] = values_in[i];
+        }
+      });
+    });
+
+    std::swap(keys_in, keys_out);
+    std::swap(values_in, values_out);
+  }
+
+  if (keys_in != keys) {
+    e = q.memcpy(keys, keys_in, n * sizeof(T), e);
+    if constexpr (has_values) {
+      e = q.memcpy(values, values_in, n * sizeof(V), e);
+    }
+  }
+
+  return complete(policy, e, std::move(keys_tmp), std::move(values_tmp));
+}
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+#include <thrust/execution_policy.h>
+#include <thrust/profiling.h>
+
+namespace thrust {
+
+namespace __detail {
+
+// Elements of T per chunk of a pipelined transfer under `policy`, at least
+// one, and no more than the `n` elements to transfer.
+template <typename T, typename ExecutionPolicy>
+std::size_t transfer_chunk_elements(const ExecutionPolicy& policy,
+                                    std::size_t n) {
+  std::size_t chunk = policy.get_transfer_chunk_size() / sizeof(T);
+  return std::min(std::max<std::size_t>(chunk, 1), n);
+}
+
+// Number of elements in [first, last) if it can be counted without
+// consuming the range, or the largest `std::size_t` otherwise.
+template <std::input_iterator I, std::sentinel_for<I> S>
+std::size_t size_hint(const I& first, const S& last) {
+  if constexpr (std::sized_sentinel_for<S, I>) {
+    return last - first;
+  } else if constexpr (std::forward_iterator<I>) {
+    return std::ranges::distance(first, last);
+  } else {
+    return std::numeric_limits<std::size_t>::max();
+  }
+}
+
+// Copy the host range [first, last), converting its elements to T, to
+// device memory at `d_first` through two pinned buffers of one chunk each.
+// The host packs chunk N + 1 into one buffer while chunk N is transferred
+// from the other, so pinned memory stays bounded however long the range is
+// and the range is read exactly once.  `size` is the number of elements if
+// it is known, and trims the buffers of short ranges.  The range is read
+// only once the policy's dependencies have completed, and every chunk but
+// the last has been transferred when the last is handed to `complete`.
+template <typename ExecutionPolicy, std::input_iterator I,
+          std::sentinel_for<I> S, typename T>
+auto pipelined_copy_to_device(ExecutionPolicy&& policy, I first, S last,
+                              T* d_first, std::size_t size) {
+  sycl::queue& q = policy.get_queue();
+  std::size_t chunk = transfer_chunk_elements<T>(policy, size);
+
+  // The dependencies may still be writing the host range.
+  sycl::event::wait(policy.get_dependencies());
+
+  // Buffers are allocated on first use, so a range that fits in one chunk
+  // takes only one.
+  std::optional<staging_buffer<T>> buffers[2];
+  sycl::event transfers[2];
+  std::size_t offset = 0;
+  std::size_t b = 0;
+
+  try {
+    for (; first != last; b ^= 1) {
+      if (!buffers[b]) {
+        buffers[b].emplace(policy, chunk);
+      }
+      // The buffer's previous chunk must be on the device before it is
+      // overwritten.
+      transfers[b].wait();
+
+      T* buffer = buffers[b]->data();
+      std::size_t count = 0;
+      for (; count < chunk && first != last; ++first) {
+        buffer[count++] = T(*first);
+      }
+
+      profile_transfer(policy, transfer_direction::host_to_device,
+                       count * sizeof(T));
+      transfers[b] = q.memcpy(d_first + offset, buffer, count * sizeof(T));
+      offset += count;
+    }
+  } catch (...) {
+    // The buffers must not be released while a transfer still reads them.
+    sycl::event::wait({transfers[0], transfers[1]});
+    throw;
+  }
+
+  if (offset == 0) {
+    return complete(policy, sycl::event());
+  }
+
+  // transfers[b ^ 1] holds the last chunk, and transfers[b] the one before.
+  transfers[b].wait();
+  return complete(policy, transfers[b ^ 1], std::move(buffers[0]),
+                  std::move(buffers[1]));
+}
+
+// Transfer n elements to device memory at `d_first` through two pinned
+// buffers of one chunk each, where `pack(buffer, offset, count)` fills a
+// buffer on the host with elements [offset, offset + count).  Chunk N + 1 is
+// packed while chunk N is transferred.  Packing starts once the policy's
+// dependencies have completed, and every chunk but the last has been
+// transferred when the last is handed to `complete`.
+template <typename ExecutionPolicy, typename T, typename Pack>
+auto pipelined_transfer_to_device(ExecutionPolicy&& policy, T* d_first,
+                                  std::size_t n, Pack&& pack) {
+  if (n == 0) {
+    sycl::event::wait(policy.get_dependencies());
+    return complete(policy, sycl::event());
+  }
+
+  // The dependencies may still be using whatever `pack` reads.
+  sycl::event::wait(policy.get_dependencies());
+
+  sycl::queue& q = policy.get_queue();
+  std::size_t chunk = transfer_chunk_elements<T>(policy, n);
+  staging_buffer<T> buffers[2] = {
+      staging_buffer<T>(policy, chunk),
+      staging_buffer<T>(policy, n > chunk ? chunk : 0)};
+  sycl::event transfers[2];
+
+  try {
+    for (std::size_t offset = 0; offset < n; offset += chunk) {
+      std::size_t count = std::min(chunk, n - offset);
+      std::size_t b = offset / chunk % 2;
+
+      transfers[b].wait();
+      pack(buffers[b].data(), offset, count);
+
+      profile_transfer(policy, transfer_direction::host_to_device,
+                       count * sizeof(T));
+      transfers[b] =
+          q.memcpy(d_first + offset, buffers[b].data(), count * sizeof(T));
+    }
+  } catch (...) {
+    // The buffers must not be released while a transfer still reads them.
+    sycl::event::wait({transfers[0], transfers[1]});
+    throw;
+  }
+
+  std::size_t last = (n - 1) / chunk % 2;
+  transfers[last ^ 1].wait();
+  return complete(policy, transfers[last], std::move(buffers[0]),
+                  std::move(buffers[1]));
+}
+
+// Transfer device memory [first, first + n) to the host through two pinned
+// buffers of one chunk each, where `unpack(buffer, offset, count)` consumes
+// elements [offset, offset + count) from a buffer.  Chunk N + 1 is
+// transferred while chunk N is unpacked.  Every chunk has been unpacked when
+// the last transfer is handed to `complete`, even under `par_nowait`.
+template <typename ExecutionPolicy, typename T, typename Unpack>
+auto pipelined_transfer_to_host(ExecutionPolicy&& policy, const T* first,
+                                std::size_t n, Unpack&& unpack) {
+  if (n == 0) {
+    sycl::event::wait(policy.get_dependencies());
+    return complete(policy, sycl::event());
+  }
+
+  using value_type = std::remove_const_t<T>;
+  sycl::queue& q = policy.get_queue();
+  std::size_t chunk = transfer_chunk_elements<value_type>(policy, n);
+  staging_buffer<value_type> buffers[2] = {
+      staging_buffer<value_type>(policy, chunk),
+      staging_buffer<value_type>(policy, n > chunk ? chunk : 0)};
+
+  auto transfer_chunk = [&](std::size_t offset) {
+    std::size_t count = std::min(chunk, n - offset);
+    profile_transfer(policy, transfer_direction::device_to_host,
+                     count * sizeof(T));
+    return q.memcpy(buffers[offset / chunk % 2].data(), first + offset,
+                    count * sizeof(T), policy.get_dependencies());
+  };
+
+  sycl::event transferred = transfer_chunk(0);
+  for (std::size_t offset = 0;; offset += chunk) {
+    std::size_t count = std::min(chunk, n - offset);
+    transferred.wait();
+
+    // The other buffer was unpacked by the previous iteration.
+    sycl::event next_transferred;
+    if (offset + chunk < n) {
+      next_transferred = transfer_chunk(offset + chunk);
+    }
+
+    try {
+      const value_type* buffer = buffers[offset / chunk % 2].data();
+      unpack(buffer, offset, count);
+    } catch (...) {
+      next_transferred.wait();
+      throw;
+    }
+
+    if (offset + chunk >= n) {
+      return complete(policy, transferred);
+    }
+    transferred = next_transferred;
+  }
+}
+
+// Copy device memory [first, first + n), n > 0, to host memory at `d_first`
+// through two pinned buffers of one chunk each, without blocking.  Each chunk
+// is transferred into a buffer and then copied into place by a host task,
+// and a buffer is refilled only once its previous chunk has been copied out,
+// so pinned memory stays bounded however large the copy is.  The copy is
+// complete when the event handed to `complete` is.
+template <typename ExecutionPolicy, typename T>
+auto queued_copy_to_host(ExecutionPolicy&& policy, const T* first,
+                         std::size_t n, std::remove_const_t<T>* d_first) {
+  using value_type = std::remove_const_t<T>;
+  sycl::queue& q = policy.get_queue();
+  std::size_t chunk = transfer_chunk_elements<value_type>(policy, n);
+  staging_buffer<value_type> buffers[2] = {
+      staging_buffer<value_type>(policy, chunk),
+      staging_buffer<value_type>(policy, n > chunk ? chunk : 0)};
+
+  // Host tasks run one after another, so the last one finishes the copy.
+  sycl::event unpacked[2];
+  sycl::event last;
+  for (std::size_t offset = 0; offset < n; offset += chunk) {
+    std::size_t count = std::min(chunk, n - offset);
+    std::size_t b = offset / chunk % 2;
+    value_type* buffer = buffers[b].data();
+    value_type* dst = d_first + offset;
+
+    std::vector<sycl::event> dependencies = policy.get_dependencies();
+    dependencies.push_back(unpacked[b]);
+    profile_transfer(policy, transfer_direction::device_to_host,
+                     count * sizeof(T));
+    auto transferred =
+        q.memcpy(buffer, first + offset, count * sizeof(T), dependencies);
+
+    last = q.submit([&](sycl::handler& h) {
+      h.depends_on({transferred, last});
+      h.host_task(
+          [=] { std::memcpy(dst, buffer, count * sizeof(value_type)); });
+    });
+    unpacked[b] = last;
+  }
+
+  return complete(policy, last, std::move(buffers[0]), std::move(buffers[1]));
+}
+
+// Copy device memory [first, first + n) to the host output iterator
+// `d_first` a chunk at a time through pinned buffers.
+template <typename ExecutionPolicy, typename T, typename O>
+auto pipelined_copy_to_host(ExecutionPolicy&& policy, const T* first,
+                            std::size_t n, O d_first) {
+  auto unpack = [&](const auto* buffer, std::size_t, std::size_t count) {
+    d_first = std::copy(buffer, buffer + count, d_first);
+  };
+  return pipelined_transfer_to_host(policy, first, n, unpack);
+}
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <type_traits>
+#include <utility>
+
+#include <thrust/detail/temporary_buffer.hpp>
+#include <thrust/event.h>
+#include <thrust/execution_policy.h>
+#include <thrust/future.h>
+#include <thrust/profiling.h>
+
+namespace thrust {
+
+namespace __detail {
+
+template <typename ExecutionPolicy>
+inline constexpr bool is_nowait_policy_v =
+    std::is_base_of_v<thrust::nowait_execution_policy,
+                      std::remove_cvref_t<ExecutionPolicy>>;
+
+// Finish an operation submitted under `policy`: blocking policies wait for
+// `e`, while `par_nowait` hands it back to the caller as a `thrust::event`.
+// Any temporary storage the operation uses is passed as `resources` so that
+// it outlives an asynchronous operation.
+template <typename ExecutionPolicy, typename... Resources>
+auto complete(ExecutionPolicy&& policy, sycl::event e,
+              Resources&&... resources) {
+  profile_completion(policy, &e);
+  if constexpr (is_nowait_policy_v<ExecutionPolicy>) {
+    if constexpr (sizeof...(Resources) == 0) {
+      return thrust::event(e);
+    } else {
+      return thrust::event(
+          e, retain_until(e, std::forward<Resources>(resources)...));
+    }
+  } else {
+    e.wait();
+  }
+}
+
+// Finish an operation whose result of type T is left in device memory at
+// `result`: blocking policies copy it back and return it, while `par_nowait`
+// returns a `thrust::future<T>`.
+template <typename T, typename ExecutionPolicy, typename... Resources>
+auto complete_value(ExecutionPolicy&& policy, sycl::event e, const T* result,
+                    Resources&&... resources) {
+  if constexpr (is_nowait_policy_v<ExecutionPolicy>) {
+    thrust::future<T> future(
+        e, policy.get_queue(), result,
+        retain_until(e, std::forward<Resources>(resources)...));
+    profile_completion(policy, &e);
+    return future;
+  } else {
+    alignas(T) char buffer[sizeof(T)];
+    auto copied = policy.get_queue().memcpy(buffer, result, sizeof(T), e);
+    profile_transfer(policy, transfer_direction::device_to_host, sizeof(T));
+    profile_completion(policy, &copied);
+    copied.wait();
+    return *reinterpret_cast<T*>(buffer);
+  }
+}
+
+// Result of an operation that finished on the host without device work.
+template <typename ExecutionPolicy, typename T>
+auto ready_value(ExecutionPolicy&& policy, const T& value) {
+  profile_completion(policy, nullptr);
+  if constexpr (is_nowait_policy_v<ExecutionPolicy>) {
+    return thrust::future<T>(value);
+  } else {
+    return value;
+  }
+}
+
+} // namespace __detail
+
+} // namespace thrust
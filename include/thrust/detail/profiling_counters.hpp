@@ -0,0 +1,27 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace thrust {
+
+namespace __detail {
+
+// Process-wide counts of work sycl-thrust does on the caller's behalf without
+// an explicit call: queues created to run algorithms called without a
+// policy, and single elements moved through `device_reference`.
+struct profiling_counters {
+  std::atomic<std::uint64_t> implicit_queue_creations{0};
+  std::atomic<std::uint64_t> device_reference_reads{0};
+  std::atomic<std::uint64_t> device_reference_writes{0};
+  std::atomic<std::uint64_t> device_reference_bytes{0};
+
+  static profiling_counters& instance() {
+    static profiling_counters counters;
+    return counters;
+  }
+};
+
+} // namespace __detail
+
+} // namespace thrust
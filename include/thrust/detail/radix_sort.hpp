@@ -0,0 +1,290 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <thrust/detail/kernel_config.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+
+namespace thrust {
+
+namespace __detail {
+
+// Placeholder value type for sorts without values.
+struct no_value {};
+
+template <typename T>
+inline constexpr bool is_radix_sortable_v =
+    std::is_arithmetic_v<T> &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+template <typename Compare, typename T>
+inline constexpr bool is_less_v = std::is_same_v<Compare, std::less<T>> ||
+                                  std::is_same_v<Compare, std::less<>>;
+
+template <typename Compare, typename T>
+inline constexpr bool is_greater_v = std::is_same_v<Compare, std::greater<T>> ||
+                                     std::is_same_v<Compare, std::greater<>>;
+
+// Radix sort handles arithmetic keys ordered by `less` or `greater`; all
+// other key types and comparators are merge sorted.
+template <typename T, typename Compare>
+inline constexpr bool use_radix_sort_v =
+    is_radix_sortable_v<T> &&
+    (is_less_v<Compare, T> || is_greater_v<Compare, T>);
+
+template <std::size_t Size>
+struct radix_bits;
+
+template <>
+struct radix_bits<1> {
+  using type = std::uint8_t;
+};
+
+template <>
+struct radix_bits<2> {
+  using type = std::uint16_t;
+};
+
+template <>
+struct radix_bits<4> {
+  using type = std::uint32_t;
+};
+
+template <>
+struct radix_bits<8> {
+  using type = std::uint64_t;
+};
+
+template <typename T>
+using radix_bits_t = typename radix_bits<sizeof(T)>::type;
+
+// Map a key to unsigned bits whose unsigned order matches the key order.
+// Keys that compare equal map to the same bits, so -0.0 and +0.0 keep their
+// relative order.
+template <bool Descending, typename T>
+radix_bits_t<T> to_radix_bits(T key) {
+  using U = radix_bits_t<T>;
+  constexpr U sign_bit = U(1) << (sizeof(U) * 8 - 1);
+
+  if constexpr (std::is_floating_point_v<T>) {
+    if (key == T(0)) {
+      key = T(0);
+    }
+  }
+
+  U bits = std::bit_cast<U>(key);
+
+  if constexpr (std::is_floating_point_v<T>) {
+    bits = (bits & sign_bit) ? U(~bits) : U(bits | sign_bit);
+  } else if constexpr (std::is_signed_v<T>) {
+    bits ^= sign_bit;
+  }
+
+  if constexpr (Descending) {
+    bits = ~bits;
+  }
+  return bits;
+}
+
+inline constexpr std::size_t radix_digit_bits = 4;
+inline constexpr std::size_t radix_size = 1 << radix_digit_bits;
+inline constexpr std::size_t radix_items_per_work_item = 4;
+
+// Stable LSD radix sort, four bits per pass.  Each pass counts digits per
+// tile in local memory, scans the (digit, tile) counts, and scatters every
+// tile in chunks, ranking keys within a chunk with a work-group scan of
+// packed 16-bit digit counters.  Keys and values ping-pong through
+// temporary buffers and end up back in place since the pass count is even.
+template <bool Descending, typename ExecutionPolicy, typename T, typename V>
+auto radix_sort(ExecutionPolicy&& policy, T* keys, V* values, std::size_t n) {
+  constexpr bool has_values = !std::is_same_v<V, no_value>;
+  constexpr std::size_t num_passes = sizeof(T) * 8 / radix_digit_bits;
+  static_assert(num_passes % 2 == 0);
+
+  sycl::queue& q = policy.get_queue();
+  std::size_t wg_size = work_group_size(q);
+  std::size_t chunk_size = wg_size * radix_items_per_work_item;
+
+  std::size_t num_tiles = num_work_groups(q, n, chunk_size);
+  std::size_t tile_size =
+      ceil_div(ceil_div(n, num_tiles), chunk_size) * chunk_size;
+  num_tiles = ceil_div(n, tile_size);
+  std::size_t num_counts = radix_size * num_tiles;
+
+  temporary_buffer<T> keys_tmp(policy, n);
+  temporary_buffer<V> values_tmp(policy, has_values ? n : 0);
+  temporary_buffer<std::size_t> counts_buffer(policy, num_counts);
+  std::size_t* counts = counts_buffer.data();
+
+  T* keys_in = keys;
+  T* keys_out = keys_tmp.data();
+  V* values_in = values;
+  V* values_out = values_tmp.data();
+
+  sycl::event e;
+  for (std::size_t pass = 0; pass < num_passes; pass++) {
+    std::size_t shift = pass * radix_digit_bits;
+
+    auto digit_of = [=](T key) {
+      return std::size_t(to_radix_bits<Descending>(key) >> shift) &
+             (radix_size - 1);
+    };
+
+    auto histogram_event = q.submit([&](sycl::handler& h) {
+      if (pass == 0) {
+        h.depends_on(policy.get_dependencies());
+      } else {
+        h.depends_on(e);
+      }
+      sycl::local_accessor<std::uint32_t, 1> local_counts(radix_size, h);
+
+      h.parallel_for(
+          sycl::nd_range<1>(num_tiles * wg_size, wg_size),
+          [=](sycl::nd_item<1> item) {
+            std::size_t lid = item.get_local_id(0);
+            std::size_t tile = item.get_group_linear_id();
+            std::size_t first = tile * tile_size;
+            std::size_t last = std::min(first + tile_size, n);
+
+            for (std::size_t d = lid; d < radix_size; d += wg_size) {
+              local_counts[d] = 0;
+            }
+            sycl::group_barrier(item.get_group());
+
+            for (std::size_t i = first + lid; i < last; i += wg_size) {
+              sycl::atomic_ref<std::uint32_t, sycl::memory_order::relaxed,
+                               sycl::memory_scope::work_group,
+                               sycl::access::address_space::local_space>
+                  counter(local_counts[digit_of(keys_in[i])]);
+              counter.fetch_add(1);
+            }
+            sycl::group_barrier(item.get_group());
+
+            for (std::size_t d = lid; d < radix_size; d += wg_size) {
+              counts[d * num_tiles + tile] = local_counts[d];
+            }
+          });
+    });
+
+    // Exclusive scan of the digit-major counts gives each (digit, tile) its
+    // first output position.
+    auto scan_event = q.submit([&](sycl::handler& h) {
+      h.depends_on(histogram_event);
+
+      h.parallel_for(sycl::nd_range<1>(wg_size, wg_size),
+                     [=](sycl::nd_item<1> item) {
+                       std::size_t lid = item.get_local_id(0);
+                       std::size_t per_item = ceil_div(num_counts, wg_size);
+                       std::size_t first = std::min(lid * per_item, num_counts);
+                       std::size_t last =
+                           std::min(first + per_item, num_counts);
+
+                       std::size_t sum = 0;
+                       for (std::size_t i = first; i < last; i++) {
+                         sum += counts[i];
+                       }
+
+                       std::size_t offset = sycl::exclusive_scan_over_group(
+                           item.get_group(), sum, sycl::plus<std::size_t>());
+
+                       for (std::size_t i = first; i < last; i++) {
+                         std::size_t count = counts[i];
+                         counts[i] = offset;
+                         offset += count;
+                       }
+                     });
+    });
+
+    e = q.submit([&](sycl::handler& h) {
+      h.depends_on(scan_event);
+      sycl::local_accessor<std::size_t, 1> offsets(radix_size, h);
+
+      h.parallel_for(
+          sycl::nd_range<1>(num_tiles * wg_size, wg_size),
+          [=](sycl::nd_item<1> item) {
+            constexpr std::size_t items = radix_items_per_work_item;
+            constexpr std::size_t words = radix_size / 4;
+
+            auto group = item.get_group();
+            std::size_t lid = item.get_local_id(0);
+            std::size_t tile = item.get_group_linear_id();
+            std::size_t first = tile * tile_size;
+            std::size_t last = std::min(first + tile_size, n);
+
+            for (std::size_t d = lid; d < radix_size; d += wg_size) {
+              offsets[d] = counts[d * num_tiles + tile];
+            }
+            sycl::group_barrier(group);
+
+            for (std::size_t chunk = first; chunk < last;
+                 chunk += chunk_size) {
+              // Digit counts of this work-item's keys, packed as four
+              // 16-bit lanes per 64-bit word.
+              std::uint64_t packed[words] = {};
+              T local_keys[items];
+              std::size_t digits[items];
+              std::size_t ranks[items];
+
+              for (std::size_t j = 0; j < items; j++) {
+                std::size_t i = chunk + lid * items + j;
+                if (i < last) {
+                  local_keys[j] = keys_in[i];
+                  digits[j] = digit_of(local_keys[j]);
+                  std::size_t lane = 16 * (digits[j] % 4);
+                  ranks[j] = (packed[digits[j] / 4] >> lane) & 0xffff;
+                  packed[digits[j] / 4] += std::uint64_t(1) << lane;
+                }
+              }
+
+              std::uint64_t prefix[words];
+              std::uint64_t totals[words];
+              for (std::size_t w = 0; w < words; w++) {
+                prefix[w] = sycl::exclusive_scan_over_group(
+                    group, packed[w], sycl::plus<std::uint64_t>());
+                totals[w] = sycl::reduce_over_group(
+                    group, packed[w], sycl::plus<std::uint64_t>());
+              }
+
+              for (std::size_t j = 0; j < items; j++) {
+                std::size_t i = chunk + lid * items + j;
+                if (i < last) {
+                  std::size_t d = digits[j];
+                  std::size_t rank =
+                      ((prefix[d / 4] >> (16 * (d % 4))) & 0xffff) + ranks[j];
+                  std::size_t position = offsets[d] + rank;
+                  keys_out[position] = local_keys[j];
+                  if constexpr (has_values) {
+                    values_out[position] = values_in[i];
+                  }
+                }
+              }
+              sycl::group_barrier(group);
+
+              for (std::size_t d = lid; d < radix_size; d += wg_size) {
+                offsets[d] += (totals[d / 4] >> (16 * (d % 4))) & 0xffff;
+              }
+              sycl::group_barrier(group);
+            }
+          });
+    });
+
+    std::swap(keys_in, keys_out);
+    std::swap(values_in, values_out);
+  }
+
+  return complete(policy, e, std::move(keys_tmp), std::move(values_tmp),
+                  std::move(counts_buffer));
+}
+
+} // namespace __detail
+
+} // namespace thrust
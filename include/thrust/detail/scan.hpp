@@ -0,0 +1,239 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <thrust/detail/kernel_config.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+
+namespace thrust {
+
+namespace __detail {
+
+inline constexpr std::size_t scan_items_per_work_item = 4;
+
+// Status of a tile during decoupled lookback.
+inline constexpr std::uint32_t tile_invalid = 0;
+inline constexpr std::uint32_t tile_aggregate_ready = 1;
+inline constexpr std::uint32_t tile_prefix_ready = 2;
+
+using tile_status_ref =
+    sycl::atomic_ref<std::uint32_t, sycl::memory_order::relaxed,
+                     sycl::memory_scope::device,
+                     sycl::access::address_space::global_space>;
+
+// Value tagged with whether it starts a segment.  Scanning with
+// `segmented_op` restarts the scan at every head.
+template <typename T>
+struct flagged_value {
+  bool head;
+  T value;
+};
+
+template <typename BinaryOp>
+struct segmented_op {
+  BinaryOp op;
+
+  template <typename T>
+  flagged_value<T> operator()(const flagged_value<T>& a,
+                              const flagged_value<T>& b) const {
+    if (b.head) {
+      return b;
+    }
+    return {a.head, op(a.value, b.value)};
+  }
+};
+
+// Spin until tile `j` has published at least its aggregate.
+inline std::uint32_t wait_for_tile(std::uint32_t* status, std::size_t j) {
+  std::uint32_t flag;
+  do {
+    flag = tile_status_ref(status[j]).load(sycl::memory_order::acquire);
+  } while (flag == tile_invalid);
+  return flag;
+}
+
+// Temporary storage used by one scan, which must outlive the scan kernel.
+template <typename T>
+struct scan_storage {
+  temporary_buffer<std::uint32_t> status;
+  temporary_buffer<T> aggregates;
+  temporary_buffer<T> prefixes;
+};
+
+// Single-pass scan with decoupled lookback.  Each work-group takes the next
+// tile, scans it in local memory and publishes the tile's aggregate.  It then
+// walks back over the preceding tiles, combining their aggregates until it
+// reaches one that has published its inclusive prefix, so every element is
+// read and written exactly once.  Tiles are numbered in the order work-groups
+// start running, so a work-group only ever waits on work-groups that are
+// already resident.
+//
+// `load(i)` returns element i.  `store(i, incl, has_prev, prev)` receives the
+// inclusive scan at i and, unless i is 0, the inclusive scan at i - 1, which
+// is enough for both inclusive and exclusive scans.  `op` must be
+// associative; no identity element is needed.  A tile stores only after
+// every earlier tile has loaded its elements, so `store(i, ...)` may
+// overwrite input elements at positions up to i.
+//
+// `submit_scan` requires n > 0 and returns the kernel's event along with the
+// storage that must be kept alive until it completes.
+template <typename ExecutionPolicy, typename Load, typename BinaryOp,
+          typename Store>
+auto submit_scan(ExecutionPolicy&& policy, std::size_t n, Load load,
+                 BinaryOp op, Store store) {
+  using T = std::remove_cvref_t<std::invoke_result_t<Load, std::size_t>>;
+  constexpr std::size_t items = scan_items_per_work_item;
+
+  sycl::queue& q = policy.get_queue();
+  std::size_t wg_size = work_group_size(q);
+  std::size_t tile_size = wg_size * items;
+  std::size_t num_tiles = ceil_div(n, tile_size);
+
+  // One status flag per tile, followed by the tile counter.
+  temporary_buffer<std::uint32_t> status_buffer(policy, num_tiles + 1);
+  temporary_buffer<T> aggregates_buffer(policy, num_tiles);
+  temporary_buffer<T> prefixes_buffer(policy, num_tiles);
+  std::uint32_t* status = status_buffer.data();
+  T* aggregates = aggregates_buffer.data();
+  T* prefixes = prefixes_buffer.data();
+
+  auto init_event = q.fill(status, tile_invalid, num_tiles + 1,
+                           policy.get_dependencies());
+
+  auto e = q.submit([&](sycl::handler& h) {
+    h.depends_on(init_event);
+    sycl::local_accessor<T, 1> tile_data(tile_size, h);
+    sycl::local_accessor<T, 1> run_totals(2 * wg_size, h);
+    sycl::local_accessor<T, 1> tile_exclusive(1, h);
+    sycl::local_accessor<std::uint32_t, 1> tile_id(1, h);
+
+    h.parallel_for(
+        sycl::nd_range<1>(num_tiles * wg_size, wg_size),
+        [=](sycl::nd_item<1> item) {
+          auto group = item.get_group();
+          std::size_t lid = item.get_local_id(0);
+
+          if (lid == 0) {
+            tile_id[0] = tile_status_ref(status[num_tiles]).fetch_add(1);
+          }
+          sycl::group_barrier(group);
+
+          std::size_t tile = tile_id[0];
+          std::size_t first = tile * tile_size;
+          std::size_t count = std::min(tile_size, n - first);
+
+          for (std::size_t l = lid; l < count; l += wg_size) {
+            tile_data[l] = load(first + l);
+          }
+          sycl::group_barrier(group);
+
+          // Each work-item scans its own run of consecutive elements.
+          std::size_t run_first = std::min(lid * items, count);
+          std::size_t run_last = std::min(run_first + items, count);
+          for (std::size_t l = run_first + 1; l < run_last; l++) {
+            tile_data[l] = op(tile_data[l - 1], tile_data[l]);
+          }
+
+          // Hillis-Steele scan of the run totals, double buffered in local
+          // memory.
+          std::size_t num_runs = ceil_div(count, items);
+          std::size_t in = 0;
+          if (lid < num_runs) {
+            run_totals[lid] = tile_data[run_last - 1];
+          }
+          for (std::size_t offset = 1; offset < num_runs; offset *= 2) {
+            sycl::group_barrier(group);
+            std::size_t out = wg_size - in;
+            if (lid < num_runs) {
+              run_totals[out + lid] =
+                  lid >= offset ? op(run_totals[in + lid - offset],
+                                     run_totals[in + lid])
+                                : run_totals[in + lid];
+            }
+            in = out;
+          }
+          sycl::group_barrier(group);
+
+          if (lid == 0) {
+            T aggregate = run_totals[in + num_runs - 1];
+
+            if (tile == 0) {
+              prefixes[0] = aggregate;
+              tile_status_ref(status[0])
+                  .store(tile_prefix_ready, sycl::memory_order::release);
+            } else {
+              aggregates[tile] = aggregate;
+              tile_status_ref(status[tile])
+                  .store(tile_aggregate_ready, sycl::memory_order::release);
+
+              std::size_t j = tile - 1;
+              std::uint32_t flag = wait_for_tile(status, j);
+              T exclusive =
+                  flag == tile_prefix_ready ? prefixes[j] : aggregates[j];
+              while (flag != tile_prefix_ready) {
+                flag = wait_for_tile(status, --j);
+                exclusive = op(
+                    flag == tile_prefix_ready ? prefixes[j] : aggregates[j],
+                    exclusive);
+              }
+
+              prefixes[tile] = op(exclusive, aggregate);
+              tile_status_ref(status[tile])
+                  .store(tile_prefix_ready, sycl::memory_order::release);
+              tile_exclusive[0] = exclusive;
+            }
+          }
+          sycl::group_barrier(group);
+
+          // Fold the preceding tiles and runs into this work-item's run.
+          if (run_first < run_last && (tile > 0 || lid > 0)) {
+            T prefix = lid == 0    ? tile_exclusive[0]
+                       : tile == 0 ? run_totals[in + lid - 1]
+                                   : op(tile_exclusive[0],
+                                        run_totals[in + lid - 1]);
+            for (std::size_t l = run_first; l < run_last; l++) {
+              tile_data[l] = op(prefix, tile_data[l]);
+            }
+          }
+          sycl::group_barrier(group);
+
+          for (std::size_t l = lid; l < count; l += wg_size) {
+            std::size_t i = first + l;
+            if (i == 0) {
+              store(i, tile_data[l], false, tile_data[l]);
+            } else {
+              store(i, tile_data[l], true,
+                    l > 0 ? tile_data[l - 1] : tile_exclusive[0]);
+            }
+          }
+        });
+  });
+
+  return std::pair{e, scan_storage<T>{std::move(status_buffer),
+                                       std::move(aggregates_buffer),
+                                       std::move(prefixes_buffer)}};
+}
+
+template <typename ExecutionPolicy, typename Load, typename BinaryOp,
+          typename Store>
+auto scan_impl(ExecutionPolicy&& policy, std::size_t n, Load load, BinaryOp op,
+               Store store) {
+  if (n == 0) {
+    sycl::event::wait(policy.get_dependencies());
+    return complete(policy, sycl::event());
+  }
+
+  auto [e, storage] = submit_scan(policy, n, load, op, store);
+  return complete(policy, e, std::move(storage));
+}
+
+} // namespace __detail
+
+} // namespace thrust
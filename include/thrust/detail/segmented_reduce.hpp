@@ -0,0 +1,227 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+#include <thrust/detail/group_reduce.hpp>
+#include <thrust/detail/kernel_config.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+
+namespace thrust {
+
+namespace __detail {
+
+// Summary of a range for `reduce_by_key`: the number of runs of equivalent
+// keys in it, its first and last keys, and the reduction of its last run.
+template <typename K, typename V>
+struct keyed_run {
+  std::size_t count;
+  K first_key;
+  K last_key;
+  V value;
+};
+
+template <typename BinaryPredicate, typename BinaryOp>
+struct keyed_run_op {
+  BinaryPredicate pred;
+  BinaryOp op;
+
+  template <typename K, typename V>
+  keyed_run<K, V> operator()(const keyed_run<K, V>& a,
+                             const keyed_run<K, V>& b) const {
+    if (pred(a.last_key, b.first_key)) {
+      return {a.count + b.count - 1, a.first_key, b.last_key,
+              b.count == 1 ? op(a.value, b.value) : b.value};
+    }
+    return {a.count + b.count, a.first_key, b.last_key, b.value};
+  }
+};
+
+// Segments up to this length are reduced by a single work-item.
+inline constexpr std::size_t segment_thread_max = 8;
+
+// Segments up to this length are reduced by a sub-group, and longer ones by
+// a whole work-group.
+inline constexpr std::size_t segment_sub_group_max = 512;
+
+inline constexpr std::size_t num_segment_bins = 3;
+
+// Segmented reduction over CSR-style offsets: segment s covers
+// [offsets[s], offsets[s + 1]) and is reduced into result[s], starting from
+// `init`.  A first kernel sorts the segments into three bins by length, so
+// that short, medium and long segments are reduced by a work-item, a
+// sub-group and a work-group respectively.  Each of the three reduction
+// kernels has a fixed grid that strides over its bin, whose size it reads on
+// the device, so one very long segment never holds up the short ones and
+// nothing waits on the host.  `op` must be associative and commutative.
+//
+// Requires m > 0, and returns the event of the last kernel along with the
+// bins, which must be kept alive until it completes.
+template <typename ExecutionPolicy, typename Iter, typename OffsetIter,
+          typename U, typename T, typename BinaryOp>
+auto submit_segmented_reduce(ExecutionPolicy&& policy, Iter first,
+                             OffsetIter offsets, std::size_t m, U* result,
+                             T init, BinaryOp op) {
+  using value_type = std::iter_value_t<Iter>;
+  using bin_ref =
+      sycl::atomic_ref<std::uint32_t, sycl::memory_order::relaxed,
+                       sycl::memory_scope::device,
+                       sycl::access::address_space::global_space>;
+  using local_bin_ref =
+      sycl::atomic_ref<std::uint32_t, sycl::memory_order::relaxed,
+                       sycl::memory_scope::work_group,
+                       sycl::access::address_space::local_space>;
+
+  sycl::queue& q = policy.get_queue();
+  std::size_t wg_size = work_group_size(q);
+
+  // Bin b holds its segment count at counts[b], and its segments from
+  // segments[b * m].
+  temporary_buffer<std::uint32_t> bins(policy, num_segment_bins * (m + 1));
+  std::uint32_t* counts = bins.data();
+  std::uint32_t* segments = counts + num_segment_bins;
+
+  auto init_event = q.fill(counts, std::uint32_t(0), num_segment_bins,
+                           policy.get_dependencies());
+
+  auto bin_event = q.submit([&](sycl::handler& h) {
+    h.depends_on(init_event);
+    sycl::local_accessor<std::uint32_t, 1> local_counts(num_segment_bins, h);
+    sycl::local_accessor<std::uint32_t, 1> local_bases(num_segment_bins, h);
+
+    h.parallel_for(
+        sycl::nd_range<1>(ceil_div(m, wg_size) * wg_size, wg_size),
+        [=](sycl::nd_item<1> item) {
+          std::size_t s = item.get_global_id(0);
+          std::size_t lid = item.get_local_id(0);
+
+          if (lid < num_segment_bins) {
+            local_counts[lid] = 0;
+          }
+          sycl::group_barrier(item.get_group());
+
+          // Count the work-group's segments per bin in local memory, so
+          // only one global atomic per bin is needed.
+          std::size_t bin = 0;
+          std::uint32_t slot = 0;
+          if (s < m) {
+            std::size_t length = offsets[s + 1] - offsets[s];
+            bin = length <= segment_thread_max      ? 0
+                  : length <= segment_sub_group_max ? 1
+                                                    : 2;
+            slot = local_bin_ref(local_counts[bin]).fetch_add(1);
+          }
+          sycl::group_barrier(item.get_group());
+
+          if (lid < num_segment_bins) {
+            local_bases[lid] =
+                bin_ref(counts[lid]).fetch_add(local_counts[lid]);
+          }
+          sycl::group_barrier(item.get_group());
+
+          if (s < m) {
+            segments[bin * m + local_bases[bin] + slot] = s;
+          }
+        });
+  });
+
+  std::size_t num_groups = num_work_groups(q, m, wg_size);
+
+  auto thread_event = q.submit([&](sycl::handler& h) {
+    h.depends_on(bin_event);
+
+    h.parallel_for(sycl::nd_range<1>(num_groups * wg_size, wg_size),
+                   [=](sycl::nd_item<1> item) {
+                     std::size_t stride = item.get_global_range(0);
+                     for (std::size_t k = item.get_global_id(0);
+                          k < counts[0]; k += stride) {
+                       std::size_t s = segments[k];
+                       T value = init;
+                       for (std::size_t i = offsets[s]; i < offsets[s + 1];
+                            i++) {
+                         value = op(value, value_type(first[i]));
+                       }
+                       result[s] = value;
+                     }
+                   });
+  });
+
+  auto sub_group_event = q.submit([&](sycl::handler& h) {
+    h.depends_on(bin_event);
+
+    h.parallel_for(
+        sycl::nd_range<1>(num_groups * wg_size, wg_size),
+        [=](sycl::nd_item<1> item) {
+          auto sg = item.get_sub_group();
+          std::size_t sg_size = sg.get_local_linear_range();
+          std::size_t lane = sg.get_local_linear_id();
+          std::size_t sg_id = item.get_group_linear_id() *
+                                  sg.get_group_linear_range() +
+                              sg.get_group_linear_id();
+          std::size_t num_sgs =
+              item.get_group_range(0) * sg.get_group_linear_range();
+
+          for (std::size_t k = sg_id; k < counts[1]; k += num_sgs) {
+            std::size_t s = segments[m + k];
+            std::size_t segment_first = offsets[s];
+            std::size_t length = offsets[s + 1] - segment_first;
+
+            // Lanes past the end load a duplicate that sub_group_reduce
+            // ignores.
+            T value =
+                value_type(first[segment_first + std::min(lane, length - 1)]);
+            for (std::size_t i = lane + sg_size; i < length; i += sg_size) {
+              value = op(value, value_type(first[segment_first + i]));
+            }
+
+            T total =
+                sub_group_reduce(sg, value, std::min(sg_size, length), op);
+            if (lane == 0) {
+              result[s] = op(init, total);
+            }
+          }
+        });
+  });
+
+  auto e = q.submit([&](sycl::handler& h) {
+    h.depends_on({thread_event, sub_group_event});
+    sycl::local_accessor<T, 1> scratch(wg_size, h);
+
+    h.parallel_for(
+        sycl::nd_range<1>(num_groups * wg_size, wg_size),
+        [=](sycl::nd_item<1> item) {
+          std::size_t lid = item.get_local_id(0);
+
+          for (std::size_t k = item.get_group_linear_id(); k < counts[2];
+               k += item.get_group_range(0)) {
+            std::size_t s = segments[2 * m + k];
+            std::size_t segment_first = offsets[s];
+            std::size_t length = offsets[s + 1] - segment_first;
+
+            T value =
+                value_type(first[segment_first + std::min(lid, length - 1)]);
+            for (std::size_t i = lid + wg_size; i < length; i += wg_size) {
+              value = op(value, value_type(first[segment_first + i]));
+            }
+
+            T total = group_reduce(item, scratch, value,
+                                   std::min(wg_size, length), op);
+            if (lid == 0) {
+              result[s] = op(init, total);
+            }
+          }
+        });
+  });
+
+  return std::pair{e, std::move(bins)};
+}
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/kernel_config.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/scan.hpp>
+#include <thrust/detail/segmented_reduce.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+
+namespace thrust {
+
+namespace __detail {
+
+// Length of the merge path each work-item walks in a CSR SpMV.
+inline constexpr std::size_t spmv_items_per_work_item = 8;
+
+// Point where a diagonal crosses the merge path: the number of rows ended
+// and of nonzeros consumed before it.
+struct merge_path_point {
+  std::size_t row;
+  std::size_t nonzero;
+};
+
+// Binary search diagonal d of the merge of the row ends
+// row_offsets[1..num_rows] (relative to row_offsets[0]) with the nonzero
+// indices 0, 1, ..., nnz - 1.  Row ends are taken before equal indices, so an
+// empty row ends before any nonzero past it is consumed.
+template <typename I>
+merge_path_point merge_path_search(const I* row_offsets, std::size_t num_rows,
+                                   std::size_t nnz, std::size_t d) {
+  std::size_t base = row_offsets[0];
+  std::size_t first = d > nnz ? d - nnz : 0;
+  std::size_t last = std::min(d, num_rows);
+
+  while (first < last) {
+    std::size_t middle = first + (last - first) / 2;
+    if (std::size_t(row_offsets[middle + 1]) - base <= d - middle - 1) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  return {first, d - first};
+}
+
+// y = alpha * A * x + beta * y for a CSR matrix A and k right-hand sides,
+// where x and y are row-major with leading dimensions ldx and ldy.
+//
+// The rows and nonzeros are split evenly by walking the merge path of row
+// ends and nonzero indices: every work-item takes the same number of path
+// steps for one column of x, whatever the row lengths.  Rows a work-item
+// finishes are written directly, and the partial sum of the row it stops in
+// is left as a carry keyed by (column, row).  Carries are ordered by key, so
+// a second pass sums each run of equal keys with a keyed scan and adds it to
+// the row it belongs to.  A carry past the last row is keyed with row
+// `num_rows` and discarded.
+//
+// When beta is zero, y is only written, so it may hold NaNs on entry.
+template <typename ExecutionPolicy, typename V, typename I, typename X,
+          typename T>
+auto spmm_impl(ExecutionPolicy&& policy, const V* values,
+               const I* row_offsets, const I* column_indices,
+               std::size_t num_rows, std::size_t nnz, std::size_t k,
+               const X* x, std::size_t ldx, T* y, std::size_t ldy, T alpha,
+               T beta) {
+  using carry_type = keyed_run<std::size_t, T>;
+  constexpr std::size_t items = spmv_items_per_work_item;
+
+  if (num_rows == 0 || k == 0) {
+    sycl::event::wait(policy.get_dependencies());
+    return complete(policy, sycl::event());
+  }
+
+  std::size_t path_length = num_rows + nnz;
+  std::size_t num_paths = ceil_div(path_length, items);
+  std::size_t num_carries = num_paths * k;
+  bool read_y = !(beta == T{});
+
+  temporary_buffer<carry_type> carries_buffer(policy, num_carries);
+  carry_type* carries = carries_buffer.data();
+
+  auto e = for_each_index(policy, num_carries, [=](std::size_t g) {
+    std::size_t path = g % num_paths;
+    std::size_t c = g / num_paths;
+    std::size_t base = row_offsets[0];
+
+    std::size_t d = path * items;
+    std::size_t d_last = std::min(d + items, path_length);
+
+    auto [row, j] = merge_path_search(row_offsets, num_rows, nnz, d);
+    auto [row_last, j_last] =
+        merge_path_search(row_offsets, num_rows, nnz, d_last);
+
+    T sum{};
+    for (; row < row_last; row++) {
+      std::size_t row_end = std::size_t(row_offsets[row + 1]) - base;
+      for (; j < row_end; j++) {
+        sum += T(values[base + j]) *
+               T(x[std::size_t(column_indices[base + j]) * ldx + c]);
+      }
+      T& out = y[row * ldy + c];
+      out = read_y ? alpha * sum + beta * out : alpha * sum;
+      sum = T{};
+    }
+    for (; j < j_last; j++) {
+      sum += T(values[base + j]) *
+             T(x[std::size_t(column_indices[base + j]) * ldx + c]);
+    }
+
+    std::size_t key = c * (num_rows + 1) + row_last;
+    carries[g] = carry_type{1, key, key, sum};
+  });
+
+  auto add_carry = [=](const carry_type& run) {
+    std::size_t row = run.last_key % (num_rows + 1);
+    std::size_t c = run.last_key / (num_rows + 1);
+    if (row < num_rows) {
+      y[row * ldy + c] += alpha * run.value;
+    }
+  };
+
+  auto [fixup_event, storage] = submit_scan(
+      policy.after(e), num_carries,
+      [=](std::size_t i) { return carries[i]; },
+      keyed_run_op<std::equal_to<std::size_t>, std::plus<T>>{},
+      [=](std::size_t i, const carry_type& incl, bool has_prev,
+          const carry_type& prev) {
+        if (has_prev && incl.count != prev.count) {
+          add_carry(prev);
+        }
+        if (i == num_carries - 1) {
+          add_carry(incl);
+        }
+      });
+
+  return complete(policy, fixup_event, std::move(carries_buffer),
+                  std::move(storage));
+}
+
+} // namespace __detail
+
+} // namespace thrust
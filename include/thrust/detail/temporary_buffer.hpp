@@ -0,0 +1,121 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include <thrust/detail/device_memory_pool.hpp>
+#include <thrust/detail/temporary_resource.hpp>
+#include <thrust/profiling.h>
+
+namespace thrust {
+
+namespace __detail {
+
+// Scratch storage for the duration of one algorithm call, taken from the
+// policy's temporary resource.
+template <typename T>
+class temporary_buffer {
+public:
+  template <typename ExecutionPolicy>
+  temporary_buffer(ExecutionPolicy&& policy, std::size_t count)
+      : resource_(policy.get_temporary_resource()), count_(count) {
+    if (count_ > 0) {
+      profile_allocation(policy, count_ * sizeof(T));
+      data_ = static_cast<T*>(resource_->allocate(count_ * sizeof(T)));
+    }
+  }
+
+  temporary_buffer(const temporary_buffer&) = delete;
+  temporary_buffer& operator=(const temporary_buffer&) = delete;
+
+  temporary_buffer(temporary_buffer&& other) noexcept
+      : resource_(std::move(other.resource_)),
+        data_(std::exchange(other.data_, nullptr)),
+        count_(std::exchange(other.count_, 0)) {}
+
+  ~temporary_buffer() {
+    if (data_ != nullptr) {
+      resource_->deallocate(data_, count_ * sizeof(T));
+    }
+  }
+
+  T* data() const noexcept {
+    return data_;
+  }
+
+  std::size_t size() const noexcept {
+    return count_;
+  }
+
+private:
+  std::shared_ptr<temporary_resource> resource_;
+  T* data_ = nullptr;
+  std::size_t count_ = 0;
+};
+
+// Pinned host scratch storage for staging transfers, drawn from a pool of
+// `sycl::malloc_host` blocks for the policy's device.
+template <typename T>
+class staging_buffer {
+public:
+  template <typename ExecutionPolicy>
+  staging_buffer(ExecutionPolicy&& policy, std::size_t count)
+      : pool_(device_memory_pool::get(policy.get_context(),
+                                      policy.get_device(),
+                                      sycl::usm::alloc::host)),
+        count_(count) {
+    if (count_ > 0) {
+      profile_allocation(policy, count_ * sizeof(T));
+      data_ = static_cast<T*>(pool_->allocate(count_ * sizeof(T)));
+    }
+  }
+
+  staging_buffer(const staging_buffer&) = delete;
+  staging_buffer& operator=(const staging_buffer&) = delete;
+
+  staging_buffer(staging_buffer&& other) noexcept
+      : pool_(std::move(other.pool_)),
+        data_(std::exchange(other.data_, nullptr)),
+        count_(std::exchange(other.count_, 0)) {}
+
+  ~staging_buffer() {
+    if (data_ != nullptr) {
+      pool_->deallocate(data_, count_ * sizeof(T));
+    }
+  }
+
+  T* data() const noexcept {
+    return data_;
+  }
+
+  std::size_t size() const noexcept {
+    return count_;
+  }
+
+private:
+  std::shared_ptr<device_memory_pool> pool_;
+  T* data_ = nullptr;
+  std::size_t count_ = 0;
+};
+
+// Keep `resources` alive until `e` has completed.  The returned handle waits
+// for `e` before releasing them, so dropping it early is safe.
+template <typename... Resources>
+std::shared_ptr<void> retain_until(sycl::event e, Resources&&... resources) {
+  using held_type = std::tuple<std::remove_cvref_t<Resources>...>;
+
+  return std::shared_ptr<void>(
+      new held_type(std::forward<Resources>(resources)...),
+      [e](void* ptr) mutable {
+        e.wait();
+        delete static_cast<held_type*>(ptr);
+      });
+}
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <thrust/detail/get_pointer_device.hpp>
+
+namespace thrust {
+
+namespace __detail {
+
+// Source of the device memory algorithms use for temporaries.
+class temporary_resource {
+public:
+  virtual ~temporary_resource() = default;
+
+  virtual void* allocate(std::size_t bytes) = 0;
+  virtual void deallocate(void* ptr, std::size_t bytes) = 0;
+};
+
+// Temporaries taken from a user allocator, rebound to bytes.
+template <typename Allocator>
+class allocator_resource final : public temporary_resource {
+public:
+  explicit allocator_resource(const Allocator& allocator)
+      : allocator_(allocator) {}
+
+  void* allocate(std::size_t bytes) override {
+    return raw_(traits::allocate(allocator_, bytes));
+  }
+
+  void deallocate(void* ptr, std::size_t bytes) override {
+    traits::deallocate(allocator_, pointer(static_cast<std::byte*>(ptr)),
+                       bytes);
+  }
+
+private:
+  using byte_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<std::byte>;
+  using traits = std::allocator_traits<byte_allocator>;
+  using pointer = typename traits::pointer;
+
+  static void* raw_(pointer ptr) {
+    if constexpr (std::is_pointer_v<pointer>) {
+      return ptr;
+    } else {
+      return ptr.get();
+    }
+  }
+
+  byte_allocator allocator_;
+};
+
+// Bump-pointer arena for the temporaries of the calls made under one policy.
+// Allocations are consecutive aligned pieces of one device block, and
+// deallocations only count them back in.  Once every piece is back, as it is
+// between calls, the arena rewinds to the start of the block.  Requests that
+// do not fit are allocated separately, and at the next rewind the block is
+// replaced by one large enough for everything handed out since the last
+// rewind, so a repeated call settles into pointer bumps alone.
+class scratch_arena final : public temporary_resource {
+public:
+  static constexpr std::size_t alignment = 256;
+
+  scratch_arena(const sycl::context& context, const sycl::device& device,
+                std::size_t initial_bytes = 0)
+      : context_(context), device_(device) {
+    if (initial_bytes > 0) {
+      std::size_t bytes = round_up_(initial_bytes);
+      block_ = malloc_(bytes);
+      capacity_ = bytes;
+    }
+  }
+
+  scratch_arena(const scratch_arena&) = delete;
+  scratch_arena& operator=(const scratch_arena&) = delete;
+
+  ~scratch_arena() {
+    for (void* ptr : overflow_) {
+      free_(ptr);
+    }
+    if (block_ != nullptr) {
+      free_(block_);
+    }
+  }
+
+  void* allocate(std::size_t bytes) override {
+    bytes = round_up_(bytes);
+
+    std::lock_guard lock(mutex_);
+    if (offset_ + bytes <= capacity_) {
+      void* ptr = static_cast<std::byte*>(block_) + offset_;
+      offset_ += bytes;
+      outstanding_++;
+      return ptr;
+    }
+
+    void* ptr = malloc_(bytes);
+    overflow_.push_back(ptr);
+    overflow_bytes_ += bytes;
+    outstanding_++;
+    return ptr;
+  }
+
+  void deallocate(void*, std::size_t) override {
+    std::lock_guard lock(mutex_);
+    if (--outstanding_ == 0) {
+      rewind_();
+    }
+  }
+
+  // Size of the block pieces are carved from.
+  std::size_t capacity() const {
+    std::lock_guard lock(mutex_);
+    return capacity_;
+  }
+
+private:
+  static std::size_t round_up_(std::size_t bytes) {
+    return (bytes + alignment - 1) / alignment * alignment;
+  }
+
+  void* malloc_(std::size_t bytes) {
+    void* ptr = sycl::malloc_device(bytes, device_, context_);
+    if (ptr == nullptr) {
+      throw std::bad_alloc();
+    }
+    pointer_registry::instance().register_allocation(ptr, bytes, device_,
+                                                     context_);
+    return ptr;
+  }
+
+  void free_(void* ptr) {
+    pointer_registry::instance().unregister_allocation(ptr);
+    sycl::free(ptr, context_);
+  }
+
+  // Called with no piece outstanding, so no device work still uses the
+  // memory being freed.
+  void rewind_() {
+    if (!overflow_.empty()) {
+      std::size_t needed = offset_ + overflow_bytes_;
+      for (void* ptr : overflow_) {
+        free_(ptr);
+      }
+      overflow_.clear();
+      overflow_bytes_ = 0;
+
+      if (block_ != nullptr) {
+        free_(block_);
+        block_ = nullptr;
+        capacity_ = 0;
+      }
+      block_ = malloc_(needed);
+      capacity_ = needed;
+    }
+    offset_ = 0;
+  }
+
+  sycl::context context_;
+  sycl::device device_;
+
+  mutable std::mutex mutex_;
+  void* block_ = nullptr;
+  std::size_t capacity_ = 0;
+  std::size_t offset_ = 0;
+  std::vector<void*> overflow_;
+  std::size_t overflow_bytes_ = 0;
+  std::size_t outstanding_ = 0;
+};
+
+} // namespace __detail
+
+} // namespace thrust
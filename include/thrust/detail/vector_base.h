@@ -1,12 +1,27 @@
 #pragma once
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
+#include <ranges>
 #include <type_traits>
+#include <vector>
 
 #include <thrust/copy.h>
+#include <thrust/detail/write_coalescer.hpp>
+#include <thrust/fill.h>
+#include <thrust/iterator/iterator_traits.h>
 
 namespace thrust {
 
+// Tag asking a vector's size constructor to leave the elements
+// uninitialized, for callers that write every element before reading any.
+struct no_init_t {
+  explicit no_init_t() = default;
+};
+
+inline constexpr no_init_t no_init{};
+
 namespace detail {
 
 template <typename T, typename Allocator = std::allocator<T>>
@@ -35,15 +50,18 @@ public:
                        const Allocator& alloc = Allocator())
       : allocator_(alloc) {
     change_capacity_impl_(count);
-    using namespace std;
-    fill(data(), data() + size(), value);
+    fill_impl_(begin(), end(), value);
   }
 
   explicit vector_base(size_type count, const Allocator& alloc = Allocator())
       : allocator_(alloc) {
     change_capacity_impl_(count);
-    using namespace std;
-    fill(data(), data() + size(), T{});
+    fill_impl_(begin(), end(), T{});
+  }
+
+  vector_base(size_type count, no_init_t, const Allocator& alloc = Allocator())
+      : allocator_(alloc) {
+    change_capacity_impl_(count);
   }
 
   template <std::forward_iterator Iter>
@@ -51,8 +69,7 @@ public:
                         const Allocator& alloc = Allocator())
       : allocator_(alloc) {
     change_capacity_impl_(std::distance(first, last));
-    using namespace std;
-    copy(first, last, begin());
+    copy_range_impl_(first, last, begin());
   }
 
   template <typename OtherAllocator>
@@ -81,6 +98,8 @@ public:
     other.size_ = 0;
     capacity_ = other.capacity_;
     other.capacity_ = 0;
+    pending_ = std::move(other.pending_);
+    other.pending_.clear();
   }
 
   vector_base(vector_base&& other, const Allocator& alloc) noexcept
@@ -92,6 +111,8 @@ public:
     other.size_ = 0;
     capacity_ = other.capacity_;
     other.capacity_ = 0;
+    pending_ = std::move(other.pending_);
+    other.pending_.clear();
   }
 
   vector_base(std::initializer_list<T> init,
@@ -107,28 +128,47 @@ public:
     return *this;
   }
 
+  // The allocator moves along with the storage, so the storage is always
+  // freed by the allocator, and in the context, that allocated it.
   vector_base& operator=(vector_base&& other) {
+    if (this == &other) {
+      return *this;
+    }
+    if (data_ != nullptr) {
+      allocator_.deallocate(data_, capacity());
+    }
+    allocator_ = other.allocator_;
     data_ = other.data_;
     other.data_ = nullptr;
     size_ = other.size_;
     other.size_ = 0;
     capacity_ = other.capacity_;
     other.capacity_ = 0;
+    pending_ = std::move(other.pending_);
+    other.pending_.clear();
     return *this;
   }
 
+  // The old contents are overwritten, so storage that is too small is
+  // replaced without copying them over.
   template <std::forward_iterator Iter>
   void assign(Iter first, Iter last) {
-    auto new_size = std::distance(first, last);
-    reserve(new_size);
-    using namespace std;
-    copy(first, last, begin());
+    size_type new_size = std::distance(first, last);
+    flush_pending_writes_impl_();
+    pending_.clear();
+    if (new_size > capacity()) {
+      change_capacity_impl_(std::max(new_size, 2 * capacity()));
+    }
+    copy_range_impl_(first, last, data_);
     size_ = new_size;
   }
 
+  // Batched appends are dropped along with the storage rather than written
+  // to it first.
   ~vector_base() noexcept {
-    if (data() != nullptr) {
-      allocator_.deallocate(data(), capacity());
+    pending_.clear();
+    if (data_ != nullptr) {
+      allocator_.deallocate(data_, capacity());
     }
   }
 
@@ -144,11 +184,19 @@ public:
     return capacity_;
   }
 
-  pointer data() noexcept {
+  // Accessors that hand out device memory first write any batched appends
+  // to it.  The const accessors do so as well, so unlike those of
+  // `std::vector` they are not safe to call from several threads at once
+  // while appends are batched.  Any access from a single thread after the
+  // last `push_back` writes the batch out, after which concurrent const
+  // access is safe again.
+  pointer data() {
+    flush_appends_impl_();
     return data_;
   }
 
-  const_pointer data() const noexcept {
+  const_pointer data() const {
+    flush_appends_impl_();
     return data_;
   }
 
@@ -156,19 +204,19 @@ public:
     return allocator_;
   }
 
-  iterator begin() noexcept {
-    return data_;
+  iterator begin() {
+    return data();
   }
 
-  iterator end() noexcept {
+  iterator end() {
     return begin() + size();
   }
 
-  const_iterator begin() const noexcept {
-    return data_;
+  const_iterator begin() const {
+    return data();
   }
 
-  const_iterator end() const noexcept {
+  const_iterator end() const {
     return begin() + size();
   }
 
@@ -180,58 +228,108 @@ public:
     return *(begin() + pos);
   }
 
+  // Grow the capacity to at least `new_cap`.  Capacity grows geometrically,
+  // so a sequence of reserves for slightly larger sizes reallocates only a
+  // logarithmic number of times.
   void reserve(size_type new_cap) {
     if (new_cap > capacity()) {
-      pointer new_data = get_allocator().allocate(new_cap);
-      using namespace std;
-      if (begin() != end()) {
-        using namespace std;
-        copy(begin(), end(), new_data);
-      }
-      if (data_ != nullptr) {
-        get_allocator().deallocate(data_, capacity());
-      }
-      data_ = new_data;
-      capacity_ = new_cap;
+      reallocate_impl_(std::max(new_cap, 2 * capacity()));
     }
   }
 
-  void push_back(const T& value) {
-    if (size() + 1 > capacity()) {
-      size_type new_capacity = next_highest_power_of_two_impl_(capacity());
-      reserve(new_capacity);
+  // Release unused capacity.
+  void shrink_to_fit() {
+    if (capacity() > size()) {
+      reallocate_impl_(size());
     }
+  }
 
-    data()[size()] = value;
-    ++size_;
+  // Appends to device memory are batched on the host and written with one
+  // transfer when the vector reallocates, when a batch fills up, or when its
+  // elements are next accessed, so a loop of `push_back` calls costs a
+  // handful of transfers rather than one per element.  See `data` for what
+  // this means for concurrent const access.
+  void push_back(const T& value) {
+    reserve(size() + 1);
+    append_impl_(value);
   }
 
   void push_back(T&& value) {
-    if (size() + 1 > capacity()) {
-      size_type new_capacity = next_highest_power_of_two_impl_(capacity());
-      reserve(new_capacity);
-    }
+    reserve(size() + 1);
+    append_impl_(value);
+  }
 
-    data()[size()] = std::move(value);
-    ++size_;
+  // Returns a reference to the new element, which writes the element, and
+  // any appends batched before it, through to device memory.  Loops should
+  // use `push_back` instead.
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    push_back(T(std::forward<Args>(args)...));
+    return data()[size() - 1];
   }
 
   bool try_push_back(const T& value) {
     if (size() + 1 <= capacity()) {
-      data()[size()] = value;
-      ++size_;
+      append_impl_(value);
       return true;
     }
     return false;
   }
 
-  void resize(size_type count, const value_type& value) {
-    if (count > capacity()) {
-      reserve(count);
+  // Insert [first, last) before `pos`.  The elements already in the vector
+  // are moved on the device, and the new elements are written with a single
+  // transfer; ranges that are neither contiguous nor device iterators are
+  // gathered into a host buffer first.  As with `std::vector`, the source
+  // must not be part of this vector, since the vector may be reallocated or
+  // shifted before the source is read.
+  template <std::forward_iterator Iter>
+  iterator insert(const_iterator pos, Iter first, Iter last) {
+    size_type offset = pos - begin();
+    size_type count = std::distance(first, last);
+    size_type tail = size() - offset;
+
+    if (count == 0) {
+      return begin() + offset;
+    }
+
+    if (size() + count > capacity()) {
+      size_type new_cap = std::max(size() + count, 2 * capacity());
+      pointer new_data = allocator_.allocate(new_cap);
+      flush_pending_writes_impl_();
+      if (offset > 0) {
+        copy_range_impl_(begin(), begin() + offset, new_data);
+      }
+      if (tail > 0) {
+        copy_range_impl_(begin() + offset, end(), new_data + offset + count);
+      }
+      if (data_ != nullptr) {
+        allocator_.deallocate(data_, capacity());
+      }
+      data_ = new_data;
+      capacity_ = new_cap;
+    } else if (tail > 0) {
+      flush_pending_writes_impl_();
+      shift_tail_impl_(offset, count);
     }
+
+    copy_range_impl_(first, last, begin() + offset);
+    size_ += count;
+    return begin() + offset;
+  }
+
+  // Append the elements of `range`, which must not be part of this vector.
+  template <std::ranges::forward_range R>
+  void append_range(R&& range) {
+    auto first = std::ranges::begin(range);
+    auto last = std::ranges::next(first, std::ranges::end(range));
+    insert(end(), first, last);
+  }
+
+  void resize(size_type count, const value_type& value) {
+    flush_appends_impl_();
+    reserve(count);
     if (count > size()) {
-      using namespace std;
-      fill(end(), begin() + count, value);
+      fill_impl_(end(), begin() + count, value);
     }
     size_ = count;
   }
@@ -241,7 +339,8 @@ public:
   }
 
 private:
-  // For use only inside constructors and assignment operators
+  // For use only inside constructors and assignment operators, which
+  // discard the old contents.
   void change_capacity_impl_(size_type count) {
     if (data_ != nullptr && capacity_ != count) {
       allocator_.deallocate(data_, capacity());
@@ -250,26 +349,100 @@ private:
     data_ = size_ ? allocator_.allocate(count) : nullptr;
   }
 
-  // NOTE: algorithm copied from "Bit Twiddling Hacks"
-  //       (Public domain)
-  constexpr size_type next_highest_power_of_two_impl_(size_type n) {
-    n--;
-    n |= n >> 1;
-    n |= n >> 2;
-    n |= n >> 4;
-    n |= n >> 8;
-    if constexpr (sizeof(size_type) > 2)
-      n |= n >> 16;
-    if constexpr (sizeof(size_type) > 4)
-      n |= n >> 32;
-    n++;
-    return n;
+  // Batched appends are written straight to the new storage.
+  void reallocate_impl_(size_type new_cap) {
+    pointer new_data = new_cap ? allocator_.allocate(new_cap) : nullptr;
+    size_type stored = size() - pending_.size();
+    if (stored > 0) {
+      flush_pending_writes_impl_();
+      copy_range_impl_(data_, data_ + stored, new_data);
+    }
+    if (data_ != nullptr) {
+      allocator_.deallocate(data_, capacity());
+    }
+    data_ = new_data;
+    capacity_ = new_cap;
+    flush_appends_impl_();
+  }
+
+  // Move the elements from `offset` on up by `count` places, which fit in
+  // the capacity.
+  void shift_tail_impl_(size_type offset, size_type count) {
+    size_type tail = size() - offset;
+    if constexpr (std::is_pointer_v<pointer>) {
+      std::copy_backward(data_ + offset, data_ + size(),
+                         data_ + size() + count);
+    } else {
+      // The source and destination may overlap, so the tail goes through
+      // scratch memory from the device's pool rather than the allocator.
+      T* first = data_.get() + offset;
+      execution_policy policy(__detail::get_pointer_queue(first));
+      __detail::temporary_buffer<T> scratch(policy, tail);
+      sycl::queue& q = policy.get_queue();
+      auto e = q.memcpy(scratch.data(), first, tail * sizeof(T));
+      q.memcpy(first + count, scratch.data(), tail * sizeof(T), e).wait();
+    }
+  }
+
+  void append_impl_(const T& value) {
+    if constexpr (std::is_pointer_v<pointer>) {
+      data_[size_] = value;
+    } else {
+      pending_.push_back(value);
+      if (pending_.size() >= append_batch_size) {
+        flush_appends_impl_();
+      }
+    }
+    ++size_;
+  }
+
+  // Write the batched appends, the last `pending_.size()` elements, to
+  // device memory, for which capacity has already been reserved.
+  void flush_appends_impl_() const {
+    if (!pending_.empty()) {
+      copy_range_impl_(pending_.begin(), pending_.end(),
+                       data_ + (size_ - pending_.size()));
+      pending_.clear();
+    }
+  }
+
+  // Element writes made inside a `coalesced_writes` scope must reach device
+  // memory before it is copied.
+  void flush_pending_writes_impl_() {
+    if constexpr (!std::is_pointer_v<pointer>) {
+      __detail::write_coalescer::instance().flush();
+    }
+  }
+
+  template <typename Iter>
+  static void copy_range_impl_(Iter first, Iter last, iterator d_first) {
+    if constexpr (std::contiguous_iterator<Iter> ||
+                  __detail::device_iterator<Iter>) {
+      using namespace std;
+      copy(first, last, d_first);
+    } else {
+      // Gather other ranges on the host so they are sent in one transfer.
+      std::vector<T> buffer(first, last);
+      copy_range_impl_(buffer.begin(), buffer.end(), d_first);
+    }
   }
 
+  static void fill_impl_(iterator first, iterator last, const T& value) {
+    if constexpr (std::is_pointer_v<iterator>) {
+      std::fill(first, last, value);
+    } else {
+      thrust::fill(first, last, value);
+    }
+  }
+
+  // Most appends batched on the host before they are written to the device.
+  static constexpr size_type append_batch_size = size_type(1) << 16;
+
   pointer data_ = nullptr;
   size_type size_ = 0;
   size_type capacity_ = 0;
   allocator_type allocator_;
+  mutable std::vector<T> pending_;
 };
 
 } // namespace detail
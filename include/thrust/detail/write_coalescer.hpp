@@ -0,0 +1,106 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <thrust/detail/get_pointer_device.hpp>
+
+namespace thrust {
+
+namespace __detail {
+
+// Per-thread buffer of host writes to device memory made through
+// `device_reference` while a `coalesced_writes` scope is open.  Writes to
+// consecutive addresses are merged into runs, and each run is sent to the
+// device as a single memcpy when the buffer is flushed.
+class write_coalescer {
+public:
+  static write_coalescer& instance() {
+    thread_local write_coalescer coalescer;
+    return coalescer;
+  }
+
+  bool active() const noexcept {
+    return depth_ > 0;
+  }
+
+  void enter() noexcept {
+    ++depth_;
+  }
+
+  // Leave a scope, flushing when it is the outermost one.  The scope is
+  // left even if the flush throws.
+  void exit() {
+    if (--depth_ == 0) {
+      flush();
+    }
+  }
+
+  void record(void* ptr, const void* value, std::size_t bytes) {
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(ptr);
+
+    if (!runs_.empty() &&
+        runs_.back().address + runs_.back().bytes == address) {
+      runs_.back().bytes += bytes;
+    } else {
+      runs_.push_back({address, data_.size(), bytes});
+    }
+
+    auto bytes_ptr = static_cast<const std::byte*>(value);
+    data_.insert(data_.end(), bytes_ptr, bytes_ptr + bytes);
+  }
+
+  // Flush if any pending write overlaps [ptr, ptr + bytes), so that reads
+  // through `device_reference` observe earlier buffered writes.
+  void flush_if_pending(const void* ptr, std::size_t bytes) {
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(ptr);
+
+    for (auto&& run : runs_) {
+      if (address < run.address + run.bytes && run.address < address + bytes) {
+        flush();
+        return;
+      }
+    }
+  }
+
+  void flush() {
+    if (runs_.empty()) {
+      return;
+    }
+
+    // Runs to the same allocation share an in-order queue, so later writes
+    // to an address still land after earlier ones.
+    std::vector<sycl::event> events;
+    events.reserve(runs_.size());
+    for (auto&& run : runs_) {
+      void* ptr = reinterpret_cast<void*>(run.address);
+      sycl::queue q = get_pointer_queue(ptr);
+      events.push_back(q.memcpy(ptr, data_.data() + run.offset, run.bytes));
+    }
+    sycl::event::wait(events);
+
+    runs_.clear();
+    data_.clear();
+  }
+
+private:
+  write_coalescer() = default;
+
+  struct run {
+    std::uintptr_t address;
+    std::size_t offset;
+    std::size_t bytes;
+  };
+
+  std::size_t depth_ = 0;
+  std::vector<run> runs_;
+  std::vector<std::byte> data_;
+};
+
+} // namespace __detail
+
+} // namespace thrust
@@ -3,6 +3,7 @@
 #include <sycl/sycl.hpp>
 
 #include <thrust/detail/default_selector.hpp>
+#include <thrust/detail/get_pointer_device.hpp>
 #include <thrust/device_ptr.h>
 
 namespace thrust {
@@ -38,15 +39,19 @@ public:
   using is_always_equal = std::false_type;
 
   pointer allocate(std::size_t size) {
+    T* ptr;
     if constexpr (Alignment == 0) {
-      return pointer(sycl::malloc_device<T>(size, device_, context_));
+      ptr = sycl::malloc_device<T>(size, device_, context_);
     } else {
-      return pointer(
-          sycl::aligned_alloc_device<T>(Alignment, size, device_, context_));
+      ptr = sycl::aligned_alloc_device<T>(Alignment, size, device_, context_);
     }
+    __detail::pointer_registry::instance().register_allocation(
+        ptr, size * sizeof(T), device_, context_);
+    return pointer(ptr);
   }
 
   void deallocate(pointer ptr, std::size_t n) {
+    __detail::pointer_registry::instance().unregister_allocation(ptr.get());
     sycl::free(ptr.get(), context_);
   }
 
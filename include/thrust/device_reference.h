@@ -5,6 +5,8 @@
 #include <type_traits>
 
 #include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/profiling_counters.hpp>
+#include <thrust/detail/write_coalescer.hpp>
 
 namespace thrust {
 
@@ -23,6 +25,10 @@ public:
 #ifdef __SYCL_DEVICE_ONLY__
     return *pointer_;
 #else
+    __detail::write_coalescer::instance().flush_if_pending(pointer_, sizeof(T));
+    auto&& counters = __detail::profiling_counters::instance();
+    ++counters.device_reference_reads;
+    counters.device_reference_bytes += sizeof(T);
     auto&& q = __detail::get_pointer_queue(pointer_);
     char buffer[sizeof(T)] __attribute__((aligned(sizeof(T))));
     q.memcpy(reinterpret_cast<std::remove_const_t<T>*>(buffer), pointer_,
@@ -38,8 +44,16 @@ public:
 #ifdef __SYCL_DEVICE_ONLY__
     *pointer_ = value;
 #else
-    auto&& q = __detail::get_pointer_queue(pointer_);
-    q.memcpy(pointer_, &value, sizeof(T)).wait();
+    auto&& coalescer = __detail::write_coalescer::instance();
+    if (coalescer.active()) {
+      coalescer.record(pointer_, &value, sizeof(T));
+    } else {
+      auto&& counters = __detail::profiling_counters::instance();
+      ++counters.device_reference_writes;
+      counters.device_reference_bytes += sizeof(T);
+      auto&& q = __detail::get_pointer_queue(pointer_);
+      q.memcpy(pointer_, &value, sizeof(T)).wait();
+    }
 #endif
     return *this;
   }
@@ -59,6 +73,34 @@ private:
   T* pointer_;
 };
 
+// While a `coalesced_writes` object is alive, host writes through
+// `device_reference` on the calling thread are buffered instead of being sent
+// one element at a time.  Each run of writes to consecutive elements is sent
+// as a single transfer when the outermost scope ends or `flush` is called.
+// Reads through `device_reference` see buffered writes, but kernels and
+// copies do not until the writes are flushed.  The destructor cannot report
+// a failed transfer, so call `flush` before the scope ends to see errors.
+class coalesced_writes {
+public:
+  coalesced_writes() noexcept {
+    __detail::write_coalescer::instance().enter();
+  }
+
+  coalesced_writes(const coalesced_writes&) = delete;
+  coalesced_writes& operator=(const coalesced_writes&) = delete;
+
+  ~coalesced_writes() {
+    try {
+      __detail::write_coalescer::instance().exit();
+    } catch (...) {
+    }
+  }
+
+  void flush() {
+    __detail::write_coalescer::instance().flush();
+  }
+};
+
 } // namespace thrust
 
 #if __has_include(<fmt/ostream.h>)
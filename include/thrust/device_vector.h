@@ -2,6 +2,7 @@
 
 #include <thrust/detail/vector_base.h>
 #include <thrust/device_allocator.h>
+#include <thrust/host_view.h>
 
 namespace thrust {
 
@@ -37,6 +38,12 @@ public:
   explicit device_vector(size_type count, const Allocator& alloc = Allocator())
       : base(count, alloc) {}
 
+  // `count` elements left uninitialized, saving the device write that fills
+  // them when every element is about to be overwritten.
+  device_vector(size_type count, no_init_t,
+                const Allocator& alloc = Allocator())
+      : base(count, no_init, alloc) {}
+
   template <std::forward_iterator Iter>
   constexpr device_vector(Iter first, Iter last,
                           const Allocator& alloc = Allocator())
@@ -62,6 +69,30 @@ public:
   device_vector(std::initializer_list<T> init,
                 const Allocator& alloc = Allocator())
       : base(init, alloc) {}
+
+  device_vector& operator=(const device_vector& other) = default;
+  device_vector& operator=(device_vector&& other) = default;
+
+  // Host mirror of [first, last), downloaded and uploaded in one transfer
+  // each according to `mode`.  Views are read-only unless asked for
+  // `access::write` or `access::read_write`.  See `thrust::host_view`.
+  thrust::host_view<T> host_view(iterator first, iterator last,
+                                 thrust::access mode = access::read) {
+    return thrust::host_view<T>(first, last, mode);
+  }
+
+  thrust::host_view<T> host_view(thrust::access mode = access::read) {
+    return host_view(this->begin(), this->end(), mode);
+  }
+
+  thrust::host_view<const T> host_view(const_iterator first,
+                                       const_iterator last) const {
+    return thrust::host_view<const T>(first, last, access::read);
+  }
+
+  thrust::host_view<const T> host_view() const {
+    return host_view(this->begin(), this->end());
+  }
 };
 
 } // namespace thrust
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/find.hpp>
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/mismatch.h>
+
+namespace thrust {
+
+// Whether two ranges of the same length match element by element, where
+// `pred` decides whether a pair of elements matches.  Returns a `bool`, or
+// under `par_nowait` a `future<bool>`, and stops at the first mismatch.
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, typename BinaryPredicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto equal(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1, Iter2 first2,
+           BinaryPredicate pred) {
+  using T1 = std::iter_value_t<Iter1>;
+  using T2 = std::iter_value_t<Iter2>;
+  std::size_t n = std::distance(first1, last1);
+
+  return __detail::find_first<bool>(
+      policy, n,
+      [=](std::size_t i) {
+        return !pred(T1(__detail::kernel_reference(first1, i)),
+                     T2(__detail::kernel_reference(first2, i)));
+      },
+      [=](std::size_t i) { return i == n; });
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto equal(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1,
+           Iter2 first2) {
+  return thrust::equal(policy, first1, last1, first2, std::equal_to<>());
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          typename BinaryPredicate>
+bool equal(Iter1 first1, Iter1 last1, Iter2 first2, BinaryPredicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first1));
+  return thrust::equal(policy, first1, last1, first2, pred);
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2>
+bool equal(Iter1 first1, Iter1 last1, Iter2 first2) {
+  return thrust::equal(first1, last1, first2, std::equal_to<>());
+}
+
+// Host ranges are compared against device ranges chunk by chunk as in
+// `mismatch`, without downloading the device range, and the comparison
+// blocks under every policy.
+
+template <typename ExecutionPolicy, std::contiguous_iterator HostIter,
+          __detail::device_iterator Iter, typename BinaryPredicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !__detail::device_iterator<HostIter>)
+auto equal(ExecutionPolicy&& policy, HostIter first1, HostIter last1,
+           Iter first2, BinaryPredicate pred) {
+  auto [end1, end2] = thrust::mismatch(policy, first1, last1, first2, pred);
+  return __detail::ready_value(policy, end1 == last1);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          std::contiguous_iterator HostIter, typename BinaryPredicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !__detail::device_iterator<HostIter>)
+auto equal(ExecutionPolicy&& policy, Iter first1, Iter last1,
+           HostIter first2, BinaryPredicate pred) {
+  auto [end1, end2] = thrust::mismatch(policy, first1, last1, first2, pred);
+  return __detail::ready_value(policy, end1 == last1);
+}
+
+template <typename ExecutionPolicy, std::contiguous_iterator HostIter,
+          __detail::device_iterator Iter>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !__detail::device_iterator<HostIter>)
+auto equal(ExecutionPolicy&& policy, HostIter first1, HostIter last1,
+           Iter first2) {
+  return thrust::equal(policy, first1, last1, first2, std::equal_to<>());
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          std::contiguous_iterator HostIter>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !__detail::device_iterator<HostIter>)
+auto equal(ExecutionPolicy&& policy, Iter first1, Iter last1,
+           HostIter first2) {
+  return thrust::equal(policy, first1, last1, first2, std::equal_to<>());
+}
+
+template <std::contiguous_iterator HostIter, __detail::device_iterator Iter,
+          typename BinaryPredicate>
+  requires(!__detail::device_iterator<HostIter>)
+bool equal(HostIter first1, HostIter last1, Iter first2,
+           BinaryPredicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first2));
+  return thrust::equal(policy, first1, last1, first2, pred);
+}
+
+template <__detail::device_iterator Iter, std::contiguous_iterator HostIter,
+          typename BinaryPredicate>
+  requires(!__detail::device_iterator<HostIter>)
+bool equal(Iter first1, Iter last1, HostIter first2, BinaryPredicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first1));
+  return thrust::equal(policy, first1, last1, first2, pred);
+}
+
+template <std::contiguous_iterator HostIter, __detail::device_iterator Iter>
+  requires(!__detail::device_iterator<HostIter>)
+bool equal(HostIter first1, HostIter last1, Iter first2) {
+  return thrust::equal(first1, last1, first2, std::equal_to<>());
+}
+
+template <__detail::device_iterator Iter, std::contiguous_iterator HostIter>
+  requires(!__detail::device_iterator<HostIter>)
+bool equal(Iter first1, Iter last1, HostIter first2) {
+  return thrust::equal(first1, last1, first2, std::equal_to<>());
+}
+
+} // namespace thrust
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace thrust {
+
+// Completion handle returned by algorithms run under `thrust::par_nowait`.
+// Pass it to `par_nowait.after(...)` to order later operations behind it, or
+// call `wait()` to block the host until it has finished.
+class event {
+public:
+  event() = default;
+
+  explicit event(sycl::event e) : event_(std::move(e)) {}
+
+  // `keep_alive` owns resources (such as temporary storage) used by the work
+  // behind `e`, and is released once the event is no longer referenced.
+  event(sycl::event e, std::shared_ptr<void> keep_alive)
+      : event_(std::move(e)), keep_alive_(std::move(keep_alive)) {}
+
+  void wait() {
+    event_.wait_and_throw();
+  }
+
+  bool ready() const {
+    return event_.get_info<sycl::info::event::command_execution_status>() ==
+           sycl::info::event_command_status::complete;
+  }
+
+  sycl::event get_event() const {
+    return event_;
+  }
+
+  operator sycl::event() const {
+    return event_;
+  }
+
+private:
+  sycl::event event_;
+  std::shared_ptr<void> keep_alive_;
+};
+
+} // namespace thrust
@@ -2,10 +2,27 @@
 
 #include <sycl/sycl.hpp>
 
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
 #include <thrust/detail/default_selector.hpp>
+#include <thrust/detail/device_memory_pool.hpp>
+#include <thrust/detail/temporary_resource.hpp>
+#include <thrust/event.h>
 
 namespace thrust {
 
+namespace __detail {
+
+// Bytes per chunk when host ranges are streamed to or from the device
+// through pinned staging buffers.
+inline constexpr std::size_t default_transfer_chunk_size =
+    std::size_t(16) << 20;
+
+} // namespace __detail
+
 class execution_policy {
 public:
   execution_policy() : queue_(thrust::default_selector_v) {}
@@ -32,14 +49,143 @@ public:
     return queue_.get_context();
   }
 
-private:
+  // Source of the scratch storage algorithms need internally: the policy's
+  // own allocator or arena if it has one, and otherwise the caching pool
+  // shared by everything on its device.
+  std::shared_ptr<__detail::temporary_resource>
+  get_temporary_resource() const {
+    if (temporary_resource_) {
+      return temporary_resource_;
+    }
+    return __detail::device_memory_pool::get(queue_.get_context(),
+                                             queue_.get_device());
+  }
+
+  // Bytes per chunk when host ranges that cannot be copied in one transfer
+  // are streamed through pinned staging buffers.
+  std::size_t get_transfer_chunk_size() const {
+    return transfer_chunk_size_;
+  }
+
+  // Events that must complete before operations run under this policy start.
+  const std::vector<sycl::event>& get_dependencies() const {
+    return dependencies_;
+  }
+
+  template <typename... Events>
+  execution_policy after(const Events&... events) const {
+    execution_policy policy(*this);
+    (policy.dependencies_.push_back(sycl::event(events)), ...);
+    return policy;
+  }
+
+  // Copy that takes scratch storage from `allocator`, which must allocate
+  // device memory usable on the policy's device, as in `par(alloc)`.
+  template <typename Allocator>
+  execution_policy operator()(const Allocator& allocator) const {
+    execution_policy policy(*this);
+    policy.use_allocator_(allocator);
+    return policy;
+  }
+
+  // Copy that runs on `queue`, keeping the policy's allocator, as in
+  // `par(alloc).on(queue)`.
+  execution_policy on(const sycl::queue& queue) const {
+    execution_policy policy(*this);
+    policy.queue_ = queue;
+    return policy;
+  }
+
+  // Copy that takes scratch storage from a bump-pointer arena of its own,
+  // shared with its copies, which rewinds whenever no call is using it.
+  // After the first call, a repeated call allocates its temporaries without
+  // touching the SYCL runtime or the shared pool.  Call `on` first if the
+  // policy is to run elsewhere.
+  execution_policy with_scratch_arena(std::size_t initial_bytes = 0) const {
+    execution_policy policy(*this);
+    policy.use_scratch_arena_(initial_bytes);
+    return policy;
+  }
+
+  // Copy that streams host ranges in chunks of `bytes`.  Larger chunks mean
+  // fewer transfers, smaller ones less pinned memory and an earlier start
+  // of the overlap between packing and transfer.
+  execution_policy with_transfer_chunk_size(std::size_t bytes) const {
+    execution_policy policy(*this);
+    policy.transfer_chunk_size_ = bytes;
+    return policy;
+  }
+
+protected:
+  template <typename Allocator>
+  void use_allocator_(const Allocator& allocator) {
+    temporary_resource_ =
+        std::make_shared<__detail::allocator_resource<Allocator>>(allocator);
+  }
+
+  void use_scratch_arena_(std::size_t initial_bytes) {
+    temporary_resource_ = std::make_shared<__detail::scratch_arena>(
+        queue_.get_context(), queue_.get_device(), initial_bytes);
+  }
+
   sycl::queue queue_;
+  std::vector<sycl::event> dependencies_;
+  std::shared_ptr<__detail::temporary_resource> temporary_resource_;
+  std::size_t transfer_chunk_size_ = __detail::default_transfer_chunk_size;
 };
 
-// TODO: support allocators, setting stream with par.
+// Policy whose algorithms return as soon as their work is submitted.  They
+// return a `thrust::event` instead of blocking, and host memory passed to
+// them must stay valid until that event completes.
+class nowait_execution_policy : public execution_policy {
+public:
+  using execution_policy::execution_policy;
+
+  template <typename... Events>
+  nowait_execution_policy after(const Events&... events) const {
+    nowait_execution_policy policy(*this);
+    (policy.dependencies_.push_back(sycl::event(events)), ...);
+    return policy;
+  }
+
+  template <typename Allocator>
+  nowait_execution_policy operator()(const Allocator& allocator) const {
+    nowait_execution_policy policy(*this);
+    policy.use_allocator_(allocator);
+    return policy;
+  }
+
+  nowait_execution_policy on(const sycl::queue& queue) const {
+    nowait_execution_policy policy(*this);
+    policy.queue_ = queue;
+    return policy;
+  }
+
+  nowait_execution_policy
+  with_scratch_arena(std::size_t initial_bytes = 0) const {
+    nowait_execution_policy policy(*this);
+    policy.use_scratch_arena_(initial_bytes);
+    return policy;
+  }
+
+  nowait_execution_policy with_transfer_chunk_size(std::size_t bytes) const {
+    nowait_execution_policy policy(*this);
+    policy.transfer_chunk_size_ = bytes;
+    return policy;
+  }
+};
+
+namespace __detail {
+
+template <typename T>
+inline constexpr bool is_execution_policy_v =
+    std::is_base_of_v<execution_policy, std::remove_cvref_t<T>>;
+
+} // namespace __detail
 
 inline execution_policy device(thrust::default_selector_v);
 inline execution_policy host(sycl::cpu_selector_v);
 inline execution_policy par(thrust::default_selector_v);
+inline nowait_execution_policy par_nowait(thrust::default_selector_v);
 
 } // namespace thrust
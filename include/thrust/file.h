@@ -0,0 +1,139 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/pipelined_copy.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/device_allocator.h>
+#include <thrust/device_ptr.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+
+namespace thrust {
+
+// Binary files of trivially copyable elements, streamed between disk and
+// device memory.  The file is read or written a transfer chunk at a time
+// straight into or out of pinned buffers, the I/O of each chunk overlapping
+// the transfer of the one before, so host memory use stays at two chunks
+// however large the file is.  Set the chunk size with
+// `with_transfer_chunk_size`.  Both block until the file has been read or
+// written, under any policy, and throw `std::runtime_error` if it cannot be.
+
+// Load `count` elements of T stored from byte `offset` of the file at
+// `path` into a new `device_vector` on the policy's device.
+template <typename T, typename ExecutionPolicy>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<T>)
+device_vector<T> load_file(ExecutionPolicy&& policy,
+                           const std::filesystem::path& path,
+                           std::size_t offset, std::size_t count) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("load_file: could not open " + path.string());
+  }
+
+  std::size_t size = std::filesystem::file_size(path);
+  if (offset > size || count > (size - offset) / sizeof(T)) {
+    throw std::runtime_error("load_file: range extends past the end of " +
+                             path.string());
+  }
+  file.seekg(offset);
+
+  // Every element is written from the file, so none is initialized first.
+  device_vector<T> result(count, no_init,
+                          device_allocator<T>(policy.get_queue()));
+  auto read_chunk = [&](T* buffer, std::size_t, std::size_t n) {
+    if (!file.read(reinterpret_cast<char*>(buffer), n * sizeof(T))) {
+      throw std::runtime_error("load_file: could not read " + path.string());
+    }
+  };
+
+  if constexpr (__detail::is_nowait_policy_v<ExecutionPolicy>) {
+    __detail::pipelined_transfer_to_device(policy, result.data().get(), count,
+                                           read_chunk)
+        .wait();
+  } else {
+    __detail::pipelined_transfer_to_device(policy, result.data().get(), count,
+                                           read_chunk);
+  }
+  return result;
+}
+
+// Load every element of T stored from byte `offset` to the end of the file.
+template <typename T, typename ExecutionPolicy>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<T>)
+device_vector<T> load_file(ExecutionPolicy&& policy,
+                           const std::filesystem::path& path,
+                           std::size_t offset = 0) {
+  std::size_t size = std::filesystem::file_size(path);
+  if (offset > size || (size - offset) % sizeof(T) != 0) {
+    throw std::runtime_error("load_file: " + path.string() +
+                             " does not hold a whole number of elements");
+  }
+  return thrust::load_file<T>(policy, path, offset,
+                              (size - offset) / sizeof(T));
+}
+
+template <typename T>
+  requires(std::is_trivially_copyable_v<T>)
+device_vector<T> load_file(const std::filesystem::path& path,
+                           std::size_t offset, std::size_t count) {
+  execution_policy policy(thrust::default_selector_v);
+  return thrust::load_file<T>(policy, path, offset, count);
+}
+
+template <typename T>
+  requires(std::is_trivially_copyable_v<T>)
+device_vector<T> load_file(const std::filesystem::path& path,
+                           std::size_t offset = 0) {
+  execution_policy policy(thrust::default_selector_v);
+  return thrust::load_file<T>(policy, path, offset);
+}
+
+// Write the elements of [first, last) to the file at `path`, replacing its
+// contents.
+template <typename ExecutionPolicy, typename T>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<T>)
+auto store_file(ExecutionPolicy&& policy, const std::filesystem::path& path,
+                device_ptr<T> first, device_ptr<T> last) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    throw std::runtime_error("store_file: could not open " + path.string());
+  }
+
+  std::size_t count = std::distance(first, last);
+  auto write_chunk = [&](const auto* buffer, std::size_t offset,
+                         std::size_t n) {
+    file.write(reinterpret_cast<const char*>(buffer), n * sizeof(T));
+    if (offset + n == count) {
+      file.flush();
+    }
+    if (!file) {
+      throw std::runtime_error("store_file: could not write " +
+                               path.string());
+    }
+  };
+  return __detail::pipelined_transfer_to_host(policy, first.get(), count,
+                                              write_chunk);
+}
+
+template <typename T>
+  requires(std::is_trivially_copyable_v<T>)
+void store_file(const std::filesystem::path& path, device_ptr<T> first,
+                device_ptr<T> last) {
+  execution_policy policy(__detail::get_pointer_queue(first.get()));
+  thrust::store_file(policy, path, first, last);
+}
+
+} // namespace thrust
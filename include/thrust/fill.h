@@ -5,6 +5,7 @@
 #include <type_traits>
 
 #include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/policy_result.hpp>
 #include <thrust/device_ptr.h>
 
 namespace thrust {
@@ -19,11 +20,12 @@ void fill(device_ptr<T> first, device_ptr<T> last, const T& value) {
 
 template <typename ExecutionPolicy, typename T>
   requires(std::is_trivially_copyable_v<T>)
-void fill(ExecutionPolicy&& policy, device_ptr<T> first, device_ptr<T> last,
+auto fill(ExecutionPolicy&& policy, device_ptr<T> first, device_ptr<T> last,
           const T& value) {
-  policy.get_queue()
-      .fill(first.get(), value, std::distance(first, last))
-      .wait();
+  auto e = policy.get_queue().fill(first.get(), value,
+                                   std::distance(first, last),
+                                   policy.get_dependencies());
+  return __detail::complete(policy, e);
 }
 
 } // namespace thrust
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/find.hpp>
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Searches return an iterator to the first element satisfying the condition,
+// or `last` if there is none, and under `par_nowait` a `future` holding it.
+// The search stops early once a match is found, so its cost depends on the
+// position of the first match rather than on the length of the range.
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto find_if(ExecutionPolicy&& policy, Iter first, Iter last,
+             Predicate pred) {
+  using value_type = std::iter_value_t<Iter>;
+  return __detail::find_first<Iter>(
+      policy, std::distance(first, last),
+      [=](std::size_t i) {
+        return pred(value_type(__detail::kernel_reference(first, i)));
+      },
+      [=](std::size_t i) { return first + i; });
+}
+
+template <__detail::device_iterator Iter, typename Predicate>
+Iter find_if(Iter first, Iter last, Predicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::find_if(policy, first, last, pred);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto find_if_not(ExecutionPolicy&& policy, Iter first, Iter last,
+                 Predicate pred) {
+  return thrust::find_if(policy, first, last,
+                         [=](const auto& value) { return !pred(value); });
+}
+
+template <__detail::device_iterator Iter, typename Predicate>
+Iter find_if_not(Iter first, Iter last, Predicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::find_if_not(policy, first, last, pred);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename T>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto find(ExecutionPolicy&& policy, Iter first, Iter last, const T& value) {
+  return thrust::find_if(policy, first, last,
+                         [=](const auto& element) { return element == value; });
+}
+
+template <__detail::device_iterator Iter, typename T>
+Iter find(Iter first, Iter last, const T& value) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::find(policy, first, last, value);
+}
+
+} // namespace thrust
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Call `f` on every element.  Elements of a `device_ptr` range are passed as
+// plain references, so `f` may modify them in place.
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename Size, typename UnaryFunction>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_integral_v<Size>)
+auto for_each_n(ExecutionPolicy&& policy, Iter first, Size n,
+                UnaryFunction f) {
+  auto e = __detail::for_each_index(policy, n, [=](std::size_t i) {
+    f(__detail::kernel_reference(first, i));
+  });
+  return __detail::complete(policy, e);
+}
+
+template <__detail::device_iterator Iter, typename Size,
+          typename UnaryFunction>
+  requires(std::is_integral_v<Size>)
+void for_each_n(Iter first, Size n, UnaryFunction f) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::for_each_n(policy, first, n, f);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename UnaryFunction>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto for_each(ExecutionPolicy&& policy, Iter first, Iter last,
+              UnaryFunction f) {
+  return thrust::for_each_n(policy, first, std::distance(first, last), f);
+}
+
+template <__detail::device_iterator Iter, typename UnaryFunction>
+void for_each(Iter first, Iter last, UnaryFunction f) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::for_each(policy, first, last, f);
+}
+
+} // namespace thrust
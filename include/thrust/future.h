@@ -0,0 +1,60 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <thrust/event.h>
+
+namespace thrust {
+
+// Value produced on the device by an algorithm run under `thrust::par_nowait`.
+// `get()` waits for the producing work and copies the value to the host.
+template <typename T>
+  requires(std::is_trivially_copyable_v<T>)
+class future {
+public:
+  future(const T& value) : value_(value) {}
+
+  future(sycl::event e, sycl::queue q, const T* result,
+         std::shared_ptr<void> keep_alive = {})
+      : event_(std::move(e), std::move(keep_alive)), queue_(std::move(q)),
+        result_(result) {}
+
+  T get() {
+    if (!value_) {
+      alignas(T) char buffer[sizeof(T)];
+      queue_->memcpy(buffer, result_, sizeof(T), event_.get_event()).wait();
+      value_.emplace(*reinterpret_cast<T*>(buffer));
+      event_ = thrust::event();
+    }
+    return *value_;
+  }
+
+  void wait() {
+    event_.wait();
+  }
+
+  bool ready() const {
+    return value_ || event_.ready();
+  }
+
+  const thrust::event& get_event() const {
+    return event_;
+  }
+
+  operator sycl::event() const {
+    return event_.get_event();
+  }
+
+private:
+  thrust::event event_;
+  std::optional<sycl::queue> queue_;
+  const T* result_ = nullptr;
+  std::optional<T> value_;
+};
+
+} // namespace thrust
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/histogram.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+namespace __detail {
+
+template <typename C>
+inline constexpr bool is_histogram_count_v =
+    std::is_integral_v<C> && !std::is_const_v<C> &&
+    (sizeof(C) == 4 || sizeof(C) == 8);
+
+} // namespace __detail
+
+// Count the elements falling in each of `num_bins` equal-width bins covering
+// [lower, upper), overwriting counts[0, num_bins).  Elements outside the
+// range are ignored.  Each work-group accumulates a private histogram in
+// local memory and merges it into `counts` at the end.
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename C, typename T>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           __detail::is_histogram_count_v<C> && std::is_arithmetic_v<T>)
+auto histogram(ExecutionPolicy&& policy, Iter first, Iter last,
+               device_ptr<C> counts, std::size_t num_bins, T lower, T upper) {
+  auto e = __detail::histogram_impl(
+      policy, first, std::distance(first, last), 1, 0, counts.get(), num_bins,
+      __detail::even_bins<T>{lower, upper, num_bins});
+  return __detail::complete(policy, e);
+}
+
+template <__detail::device_iterator Iter, typename C, typename T>
+  requires(__detail::is_histogram_count_v<C> && std::is_arithmetic_v<T>)
+void histogram(Iter first, Iter last, device_ptr<C> counts,
+               std::size_t num_bins, T lower, T upper) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::histogram(policy, first, last, counts, num_bins, lower, upper);
+}
+
+// Count the elements falling in each bin given by the ascending edges
+// [edges_first, edges_last), where bin b covers [edges[b], edges[b + 1]).
+// One count is written per bin, one fewer than there are edges.
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator EdgeIter, typename C>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           __detail::is_histogram_count_v<C>)
+auto histogram(ExecutionPolicy&& policy, Iter first, Iter last,
+               EdgeIter edges_first, EdgeIter edges_last,
+               device_ptr<C> counts) {
+  std::size_t num_edges = std::distance(edges_first, edges_last);
+  std::size_t num_bins = num_edges > 0 ? num_edges - 1 : 0;
+
+  auto e = __detail::histogram_impl(
+      policy, first, std::distance(first, last), 1, 0, counts.get(), num_bins,
+      __detail::edge_bins<EdgeIter>{edges_first, num_bins});
+  return __detail::complete(policy, e);
+}
+
+template <__detail::device_iterator Iter, __detail::device_iterator EdgeIter,
+          typename C>
+  requires(__detail::is_histogram_count_v<C>)
+void histogram(Iter first, Iter last, EdgeIter edges_first,
+               EdgeIter edges_last, device_ptr<C> counts) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::histogram(policy, first, last, edges_first, edges_last, counts);
+}
+
+// Histograms of `num_columns` columns of n elements at once, with the same
+// equal-width bins for every column.  Column c starts at first + c * ld, and
+// its counts are written to counts[c * num_bins, (c + 1) * num_bins).
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename C, typename T>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           __detail::is_histogram_count_v<C> && std::is_arithmetic_v<T>)
+auto multi_histogram(ExecutionPolicy&& policy, Iter first, std::size_t n,
+                     std::size_t num_columns, std::size_t ld,
+                     device_ptr<C> counts, std::size_t num_bins, T lower,
+                     T upper) {
+  auto e = __detail::histogram_impl(
+      policy, first, n, num_columns, ld, counts.get(), num_bins,
+      __detail::even_bins<T>{lower, upper, num_bins});
+  return __detail::complete(policy, e);
+}
+
+template <__detail::device_iterator Iter, typename C, typename T>
+  requires(__detail::is_histogram_count_v<C> && std::is_arithmetic_v<T>)
+void multi_histogram(Iter first, std::size_t n, std::size_t num_columns,
+                     std::size_t ld, device_ptr<C> counts,
+                     std::size_t num_bins, T lower, T upper) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::multi_histogram(policy, first, n, num_columns, ld, counts, num_bins,
+                          lower, upper);
+}
+
+} // namespace thrust
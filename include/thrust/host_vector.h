@@ -0,0 +1,81 @@
+#pragma once
+
+#include <thrust/detail/vector_base.h>
+#include <thrust/device_vector.h>
+#include <thrust/pinned_allocator.h>
+
+namespace thrust {
+
+// Vector in pinned host memory.  Its elements are ordinary host objects, but
+// copies between a `host_vector` and device memory are direct DMA transfers
+// that `par_nowait` can queue without staging through a pageable buffer.
+template <typename T, typename Allocator = thrust::pinned_allocator<T>>
+  requires(std::is_trivially_copyable_v<T> &&
+           std::is_trivially_destructible_v<T>)
+class host_vector : public detail::vector_base<T, Allocator> {
+private:
+  using base = detail::vector_base<T, Allocator>;
+
+public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = typename std::allocator_traits<allocator_type>::pointer;
+  using const_pointer =
+      typename std::allocator_traits<allocator_type>::const_pointer;
+  using reference = decltype(*std::declval<pointer>());
+  using const_reference = decltype(*std::declval<const_pointer>());
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+
+  host_vector() noexcept(noexcept(Allocator())) : base() {}
+
+  explicit host_vector(const Allocator& allocator) noexcept
+      : base(allocator) {}
+
+  explicit host_vector(size_type count, const T& value,
+                       const Allocator& alloc = Allocator())
+      : base(count, value, alloc) {}
+
+  explicit host_vector(size_type count, const Allocator& alloc = Allocator())
+      : base(count, alloc) {}
+
+  template <std::forward_iterator Iter>
+  constexpr host_vector(Iter first, Iter last,
+                        const Allocator& alloc = Allocator())
+      : base(first, last, alloc) {}
+
+  template <typename OtherAllocator>
+  constexpr host_vector(const std::vector<T, OtherAllocator>& other)
+      : base(other) {}
+
+  // Pinned memory is allocated for the device that owns `other`.
+  template <typename OtherAllocator>
+  host_vector(const device_vector<T, OtherAllocator>& other)
+      : base(other.begin(), other.end(),
+             Allocator(other.get_allocator().get_context(),
+                       other.get_allocator().get_device())) {}
+
+  host_vector(const host_vector& other) : base(other) {}
+
+  host_vector(const host_vector& other, const Allocator& alloc)
+      : base(other, alloc) {}
+
+  host_vector(host_vector&& other) noexcept
+    requires(std::is_trivially_move_constructible_v<T>)
+      : base(std::move(other)) {}
+
+  host_vector(host_vector&& other, const Allocator& alloc) noexcept
+    requires(std::is_trivially_move_constructible_v<T>)
+      : base(std::move(other), alloc) {}
+
+  host_vector(std::initializer_list<T> init,
+              const Allocator& alloc = Allocator())
+      : base(init, alloc) {}
+
+  host_vector& operator=(const host_vector& other) = default;
+  host_vector& operator=(host_vector&& other) = default;
+};
+
+} // namespace thrust
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+
+namespace thrust {
+
+// How a `host_view` uses the device range it mirrors.  `read` downloads the
+// range and never writes it back, `write` starts from uninitialized host
+// memory and uploads it, and `read_write` does both.
+enum class access { read, write, read_write };
+
+// Host mirror of a range of device memory, held in pinned memory.  The range
+// is downloaded once when the view is created and, unless the view is
+// read-only, uploaded once when it is flushed or destroyed, so loops over
+// its elements cost one transfer rather than one per element.  A flush
+// uploads only if the elements may have been written since the view was
+// created or last flushed, that is, if they have been accessed through
+// `data`, `span`, `begin` or `operator[]` since then.  Errors in the upload
+// made on destruction are ignored, so call `flush` to observe them.  The
+// device range must not be used by other operations while the view is
+// alive.
+template <typename T>
+  requires(std::is_trivially_copyable_v<T>)
+class host_view {
+public:
+  using element_type = T;
+  using value_type = std::remove_const_t<T>;
+  using size_type = std::size_t;
+  using iterator = T*;
+
+  host_view(device_ptr<T> first, device_ptr<T> last,
+            thrust::access mode = thrust::access::read)
+      : queue_(__detail::get_pointer_queue(first.get())), device_(first),
+        mode_(std::is_const_v<T> ? thrust::access::read : mode),
+        buffer_(execution_policy(queue_), last - first) {
+    if (mode_ != thrust::access::write && size() > 0) {
+      queue_.memcpy(buffer_.data(), device_.get(), size() * sizeof(T)).wait();
+    }
+  }
+
+  host_view(const host_view&) = delete;
+  host_view& operator=(const host_view&) = delete;
+
+  host_view(host_view&& other) noexcept
+      : queue_(other.queue_), device_(other.device_), mode_(other.mode_),
+        dirty_(other.dirty_), buffer_(std::move(other.buffer_)) {
+    other.mode_ = thrust::access::read;
+    other.dirty_ = false;
+  }
+
+  ~host_view() {
+    try {
+      flush();
+    } catch (...) {
+    }
+  }
+
+  // Upload the host copy to the device now, if it may have been written
+  // since the last upload.  Read-only views do nothing.
+  void flush() {
+    if constexpr (!std::is_const_v<T>) {
+      if (mode_ != thrust::access::read && dirty_ && size() > 0) {
+        queue_.memcpy(device_.get(), buffer_.data(), size() * sizeof(T))
+            .wait();
+      }
+    }
+    dirty_ = false;
+  }
+
+  std::span<T> span() const noexcept {
+    return std::span<T>(data(), size());
+  }
+
+  operator std::span<T>() const noexcept {
+    return span();
+  }
+
+  T* data() const noexcept {
+    dirty_ = true;
+    return buffer_.data();
+  }
+
+  size_type size() const noexcept {
+    return buffer_.size();
+  }
+
+  bool empty() const noexcept {
+    return size() == 0;
+  }
+
+  iterator begin() const noexcept {
+    return data();
+  }
+
+  iterator end() const noexcept {
+    return data() + size();
+  }
+
+  T& operator[](size_type pos) const noexcept {
+    return data()[pos];
+  }
+
+private:
+  sycl::queue queue_;
+  device_ptr<T> device_;
+  thrust::access mode_;
+  mutable bool dirty_ = false;
+  __detail::staging_buffer<value_type> buffer_;
+};
+
+} // namespace thrust
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include <thrust/detail/iterator_facade.hpp>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Iterator whose every element is `value`.  Only the position is advanced.
+template <typename T>
+  requires(std::is_trivially_copyable_v<T>)
+class constant_iterator
+    : public __detail::iterator_facade<constant_iterator<T>, T> {
+public:
+  constexpr constant_iterator() = default;
+
+  constexpr explicit constant_iterator(const T& value,
+                                       std::ptrdiff_t index = 0)
+      : value_(value), index_(index) {}
+
+  constexpr std::ptrdiff_t base() const noexcept {
+    return index_;
+  }
+
+private:
+  friend class __detail::iterator_core_access;
+
+  constexpr T dereference() const {
+    return value_;
+  }
+
+  constexpr void advance(std::ptrdiff_t n) noexcept {
+    index_ += n;
+  }
+
+  constexpr std::ptrdiff_t
+  distance_to(const constant_iterator& other) const noexcept {
+    return other.index_ - index_;
+  }
+
+  T value_ = T{};
+  std::ptrdiff_t index_ = 0;
+};
+
+template <typename T>
+constexpr constant_iterator<T>
+make_constant_iterator(const T& value, std::ptrdiff_t index = 0) {
+  return constant_iterator<T>(value, index);
+}
+
+namespace __detail {
+
+template <typename T>
+struct device_iterator_traits<constant_iterator<T>> {
+  static const void* memory(const constant_iterator<T>&) {
+    return nullptr;
+  }
+};
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include <thrust/detail/iterator_facade.hpp>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Iterator over the sequence value, value + 1, value + 2, ...  Elements are
+// computed from the position, so no memory is read.
+template <typename T>
+  requires(std::is_arithmetic_v<T>)
+class counting_iterator
+    : public __detail::iterator_facade<counting_iterator<T>, T> {
+public:
+  constexpr counting_iterator() noexcept = default;
+
+  constexpr explicit counting_iterator(T value) noexcept : value_(value) {}
+
+  constexpr T base() const noexcept {
+    return value_;
+  }
+
+private:
+  friend class __detail::iterator_core_access;
+
+  constexpr T dereference() const noexcept {
+    return value_;
+  }
+
+  constexpr void advance(std::ptrdiff_t n) noexcept {
+    value_ += static_cast<T>(n);
+  }
+
+  constexpr std::ptrdiff_t distance_to(const counting_iterator& other) const {
+    return static_cast<std::ptrdiff_t>(other.value_) -
+           static_cast<std::ptrdiff_t>(value_);
+  }
+
+  T value_ = T{};
+};
+
+template <typename T>
+constexpr counting_iterator<T> make_counting_iterator(T value) {
+  return counting_iterator<T>(value);
+}
+
+namespace __detail {
+
+template <typename T>
+struct device_iterator_traits<counting_iterator<T>> {
+  static const void* memory(const counting_iterator<T>&) {
+    return nullptr;
+  }
+};
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <type_traits>
+
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+
+namespace thrust {
+
+namespace __detail {
+
+// Describes iterators that can be dereferenced inside a SYCL kernel.  Each
+// specialization provides `memory(iter)`, which returns device memory the
+// iterator reads from, or null if it computes its elements.  Algorithms
+// called without an execution policy run on the queue owning that memory.
+template <typename Iterator>
+struct device_iterator_traits;
+
+template <typename T>
+struct device_iterator_traits<device_ptr<T>> {
+  static const void* memory(const device_ptr<T>& iter) {
+    return iter.get();
+  }
+};
+
+template <typename Iterator>
+concept device_iterator = requires(const Iterator& iter) {
+  {
+    device_iterator_traits<Iterator>::memory(iter)
+  } -> std::convertible_to<const void*>;
+};
+
+template <typename Iterator>
+inline constexpr bool is_device_ptr_v = false;
+
+template <typename T>
+inline constexpr bool is_device_ptr_v<device_ptr<T>> = true;
+
+template <device_iterator Iterator>
+const void* iterator_memory(const Iterator& iter) {
+  return device_iterator_traits<Iterator>::memory(iter);
+}
+
+// Queue for an algorithm called on `iter` without an execution policy.
+// Iterators that do not touch memory run on the default device.
+template <device_iterator Iterator>
+sycl::queue get_iterator_queue(const Iterator& iter) {
+  if (const void* ptr = iterator_memory(iter)) {
+    return get_pointer_queue(ptr);
+  }
+  return thrust::device.get_queue();
+}
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+#include <thrust/detail/iterator_facade.hpp>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Iterator over `elements[indices[0]], elements[indices[1]], ...`.  The
+// gather happens where the element is read, and elements can be written
+// through it when the element iterator is writable.
+template <__detail::device_iterator ElementIterator,
+          __detail::device_iterator IndexIterator>
+class permutation_iterator
+    : public __detail::iterator_facade<
+          permutation_iterator<ElementIterator, IndexIterator>,
+          std::iter_value_t<ElementIterator>,
+          std::iter_reference_t<ElementIterator>> {
+public:
+  constexpr permutation_iterator(ElementIterator elements,
+                                 IndexIterator indices)
+      : elements_(elements), indices_(indices) {}
+
+  constexpr ElementIterator base() const {
+    return elements_;
+  }
+
+  constexpr IndexIterator indices() const {
+    return indices_;
+  }
+
+private:
+  friend class __detail::iterator_core_access;
+
+  constexpr std::iter_reference_t<ElementIterator> dereference() const {
+    return elements_[static_cast<std::ptrdiff_t>(
+        std::iter_value_t<IndexIterator>(*indices_))];
+  }
+
+  constexpr void advance(std::ptrdiff_t n) {
+    indices_ += n;
+  }
+
+  constexpr std::ptrdiff_t
+  distance_to(const permutation_iterator& other) const {
+    return other.indices_ - indices_;
+  }
+
+  ElementIterator elements_;
+  IndexIterator indices_;
+};
+
+template <__detail::device_iterator ElementIterator,
+          __detail::device_iterator IndexIterator>
+constexpr permutation_iterator<ElementIterator, IndexIterator>
+make_permutation_iterator(ElementIterator elements, IndexIterator indices) {
+  return permutation_iterator<ElementIterator, IndexIterator>(elements,
+                                                              indices);
+}
+
+namespace __detail {
+
+template <typename ElementIterator, typename IndexIterator>
+struct device_iterator_traits<
+    permutation_iterator<ElementIterator, IndexIterator>> {
+  static const void*
+  memory(const permutation_iterator<ElementIterator, IndexIterator>& iter) {
+    if (const void* ptr = iterator_memory(iter.base())) {
+      return ptr;
+    }
+    return iterator_memory(iter.indices());
+  }
+};
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/iterator_facade.hpp>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+template <typename Iterator, typename UnaryFunction>
+using transform_iterator_value_t = std::remove_cvref_t<
+    std::invoke_result_t<const UnaryFunction&, std::iter_value_t<Iterator>>>;
+
+// Iterator yielding `f(*iter)` for each element of the underlying range.
+// The function is applied where the element is read, so a transform over
+// device memory fuses into whatever kernel consumes it.
+template <__detail::device_iterator Iterator, typename UnaryFunction>
+class transform_iterator
+    : public __detail::iterator_facade<
+          transform_iterator<Iterator, UnaryFunction>,
+          transform_iterator_value_t<Iterator, UnaryFunction>> {
+public:
+  constexpr transform_iterator(Iterator iter, UnaryFunction f)
+      : iter_(iter), f_(f) {}
+
+  constexpr Iterator base() const {
+    return iter_;
+  }
+
+  constexpr UnaryFunction functor() const {
+    return f_;
+  }
+
+private:
+  friend class __detail::iterator_core_access;
+
+  constexpr transform_iterator_value_t<Iterator, UnaryFunction>
+  dereference() const {
+    return f_(std::iter_value_t<Iterator>(*iter_));
+  }
+
+  constexpr void advance(std::ptrdiff_t n) {
+    iter_ += n;
+  }
+
+  constexpr std::ptrdiff_t distance_to(const transform_iterator& other) const {
+    return other.iter_ - iter_;
+  }
+
+  Iterator iter_;
+  UnaryFunction f_;
+};
+
+template <__detail::device_iterator Iterator, typename UnaryFunction>
+constexpr transform_iterator<Iterator, UnaryFunction>
+make_transform_iterator(Iterator iter, UnaryFunction f) {
+  return transform_iterator<Iterator, UnaryFunction>(iter, f);
+}
+
+namespace __detail {
+
+template <typename Iterator, typename UnaryFunction>
+struct device_iterator_traits<transform_iterator<Iterator, UnaryFunction>> {
+  static const void*
+  memory(const transform_iterator<Iterator, UnaryFunction>& iter) {
+    return iterator_memory(iter.base());
+  }
+};
+
+} // namespace __detail
+
+} // namespace thrust
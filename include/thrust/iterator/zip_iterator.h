@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+#include <thrust/detail/iterator_facade.hpp>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Iterator over tuples of the corresponding elements of several ranges.
+// Dereferencing yields a `std::tuple` of the underlying references, which
+// converts to the `std::tuple` of values, so zipped ranges can be read and
+// written element-wise inside one kernel.
+template <__detail::device_iterator... Iterators>
+  requires(sizeof...(Iterators) > 0)
+class zip_iterator
+    : public __detail::iterator_facade<
+          zip_iterator<Iterators...>,
+          std::tuple<std::iter_value_t<Iterators>...>,
+          std::tuple<std::iter_reference_t<Iterators>...>> {
+public:
+  using iterator_tuple = std::tuple<Iterators...>;
+
+  constexpr explicit zip_iterator(Iterators... iters) : iters_(iters...) {}
+
+  constexpr explicit zip_iterator(const iterator_tuple& iters)
+      : iters_(iters) {}
+
+  constexpr const iterator_tuple& get_iterator_tuple() const {
+    return iters_;
+  }
+
+private:
+  friend class __detail::iterator_core_access;
+
+  constexpr std::tuple<std::iter_reference_t<Iterators>...>
+  dereference() const {
+    return std::apply(
+        [](const auto&... iters) {
+          return std::tuple<std::iter_reference_t<Iterators>...>(*iters...);
+        },
+        iters_);
+  }
+
+  constexpr void advance(std::ptrdiff_t n) {
+    std::apply([n](auto&... iters) { ((iters += n), ...); }, iters_);
+  }
+
+  constexpr std::ptrdiff_t distance_to(const zip_iterator& other) const {
+    return std::get<0>(other.iters_) - std::get<0>(iters_);
+  }
+
+  iterator_tuple iters_;
+};
+
+template <__detail::device_iterator... Iterators>
+constexpr zip_iterator<Iterators...> make_zip_iterator(Iterators... iters) {
+  return zip_iterator<Iterators...>(iters...);
+}
+
+template <__detail::device_iterator... Iterators>
+constexpr zip_iterator<Iterators...>
+make_zip_iterator(const std::tuple<Iterators...>& iters) {
+  return zip_iterator<Iterators...>(iters);
+}
+
+namespace __detail {
+
+template <typename... Iterators>
+struct device_iterator_traits<zip_iterator<Iterators...>> {
+  static const void* memory(const zip_iterator<Iterators...>& iter) {
+    const void* ptr = nullptr;
+    std::apply(
+        [&](const auto&... iters) {
+          ((ptr = ptr ? ptr : iterator_memory(iters)), ...);
+        },
+        iter.get_iterator_tuple());
+    return ptr;
+  }
+};
+
+} // namespace __detail
+
+} // namespace thrust
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/find.hpp>
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Each of these returns a `bool`, or under `par_nowait` a `future<bool>`, and
+// stops examining the range as soon as the answer is known.
+
+// Whether `pred` holds for some element of the range.
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto any_of(ExecutionPolicy&& policy, Iter first, Iter last, Predicate pred) {
+  using value_type = std::iter_value_t<Iter>;
+  std::size_t n = std::distance(first, last);
+  return __detail::find_first<bool>(
+      policy, n,
+      [=](std::size_t i) {
+        return pred(value_type(__detail::kernel_reference(first, i)));
+      },
+      [=](std::size_t i) { return i < n; });
+}
+
+template <__detail::device_iterator Iter, typename Predicate>
+bool any_of(Iter first, Iter last, Predicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::any_of(policy, first, last, pred);
+}
+
+// Whether `pred` holds for every element of the range, which is true of an
+// empty range.
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto all_of(ExecutionPolicy&& policy, Iter first, Iter last, Predicate pred) {
+  using value_type = std::iter_value_t<Iter>;
+  std::size_t n = std::distance(first, last);
+  return __detail::find_first<bool>(
+      policy, n,
+      [=](std::size_t i) {
+        return !pred(value_type(__detail::kernel_reference(first, i)));
+      },
+      [=](std::size_t i) { return i == n; });
+}
+
+template <__detail::device_iterator Iter, typename Predicate>
+bool all_of(Iter first, Iter last, Predicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::all_of(policy, first, last, pred);
+}
+
+// Whether `pred` holds for no element of the range.
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto none_of(ExecutionPolicy&& policy, Iter first, Iter last,
+             Predicate pred) {
+  using value_type = std::iter_value_t<Iter>;
+  std::size_t n = std::distance(first, last);
+  return __detail::find_first<bool>(
+      policy, n,
+      [=](std::size_t i) {
+        return pred(value_type(__detail::kernel_reference(first, i)));
+      },
+      [=](std::size_t i) { return i == n; });
+}
+
+template <__detail::device_iterator Iter, typename Predicate>
+bool none_of(Iter first, Iter last, Predicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::none_of(policy, first, last, pred);
+}
+
+} // namespace thrust
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/merge.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Merge two sorted ranges into `result`, which must not overlap them.  The
+// merge is stable: equivalent elements keep their order, and those of the
+// first range come first.  Work is split along the merge path, so every
+// work-item produces the same number of elements however the inputs
+// interleave.  Returns the end of the output, or under `par_nowait` an
+// event.
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto merge(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1, Iter2 first2,
+           Iter2 last2, device_ptr<U> result, Compare comp) {
+  using T1 = std::iter_value_t<Iter1>;
+  using T2 = std::iter_value_t<Iter2>;
+
+  std::size_t n1 = std::distance(first1, last1);
+  std::size_t n2 = std::distance(first2, last2);
+  U* out = result.get();
+
+  auto e = __detail::merge_path_walk(
+      policy, first1, n1, first2, n2, comp,
+      [=](std::size_t i, std::size_t j) {
+        out[i + j] = U(T1(__detail::kernel_reference(first1, i)));
+      },
+      [=](std::size_t i, std::size_t j) {
+        out[i + j] = U(T2(__detail::kernel_reference(first2, j)));
+      });
+
+  if constexpr (__detail::is_nowait_policy_v<ExecutionPolicy>) {
+    return __detail::complete(policy, e);
+  } else {
+    __detail::complete(policy, e);
+    return result + (n1 + n2);
+  }
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto merge(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1, Iter2 first2,
+           Iter2 last2, device_ptr<U> result) {
+  return thrust::merge(policy, first1, last1, first2, last2, result,
+                       std::less<std::iter_value_t<Iter1>>());
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          typename U, typename Compare>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> merge(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2,
+                    device_ptr<U> result, Compare comp) {
+  execution_policy policy(__detail::get_iterator_queue(first1));
+  return thrust::merge(policy, first1, last1, first2, last2, result, comp);
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> merge(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2,
+                    device_ptr<U> result) {
+  return thrust::merge(first1, last1, first2, last2, result,
+                       std::less<std::iter_value_t<Iter1>>());
+}
+
+// Merge two sorted key ranges and move each key's value along with it.
+// Returns the ends of both outputs, or under `par_nowait` an event.
+template <typename ExecutionPolicy, __detail::device_iterator KeyIter1,
+          __detail::device_iterator KeyIter2,
+          __detail::device_iterator ValueIter1,
+          __detail::device_iterator ValueIter2, typename KeyOut,
+          typename ValueOut, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<KeyOut> && !std::is_const_v<KeyOut> &&
+           std::is_trivially_copyable_v<ValueOut> &&
+           !std::is_const_v<ValueOut>)
+auto merge_by_key(ExecutionPolicy&& policy, KeyIter1 keys_first1,
+                  KeyIter1 keys_last1, KeyIter2 keys_first2,
+                  KeyIter2 keys_last2, ValueIter1 values_first1,
+                  ValueIter2 values_first2, device_ptr<KeyOut> keys_result,
+                  device_ptr<ValueOut> values_result, Compare comp) {
+  using K1 = std::iter_value_t<KeyIter1>;
+  using K2 = std::iter_value_t<KeyIter2>;
+  using V1 = std::iter_value_t<ValueIter1>;
+  using V2 = std::iter_value_t<ValueIter2>;
+
+  std::size_t n1 = std::distance(keys_first1, keys_last1);
+  std::size_t n2 = std::distance(keys_first2, keys_last2);
+  KeyOut* keys_out = keys_result.get();
+  ValueOut* values_out = values_result.get();
+
+  auto e = __detail::merge_path_walk(
+      policy, keys_first1, n1, keys_first2, n2, comp,
+      [=](std::size_t i, std::size_t j) {
+        keys_out[i + j] =
+            KeyOut(K1(__detail::kernel_reference(keys_first1, i)));
+        values_out[i + j] =
+            ValueOut(V1(__detail::kernel_reference(values_first1, i)));
+      },
+      [=](std::size_t i, std::size_t j) {
+        keys_out[i + j] =
+            KeyOut(K2(__detail::kernel_reference(keys_first2, j)));
+        values_out[i + j] =
+            ValueOut(V2(__detail::kernel_reference(values_first2, j)));
+      });
+
+  if constexpr (__detail::is_nowait_policy_v<ExecutionPolicy>) {
+    return __detail::complete(policy, e);
+  } else {
+    __detail::complete(policy, e);
+    return std::pair{keys_result + (n1 + n2), values_result + (n1 + n2)};
+  }
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator KeyIter1,
+          __detail::device_iterator KeyIter2,
+          __detail::device_iterator ValueIter1,
+          __detail::device_iterator ValueIter2, typename KeyOut,
+          typename ValueOut>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<KeyOut> && !std::is_const_v<KeyOut> &&
+           std::is_trivially_copyable_v<ValueOut> &&
+           !std::is_const_v<ValueOut>)
+auto merge_by_key(ExecutionPolicy&& policy, KeyIter1 keys_first1,
+                  KeyIter1 keys_last1, KeyIter2 keys_first2,
+                  KeyIter2 keys_last2, ValueIter1 values_first1,
+                  ValueIter2 values_first2, device_ptr<KeyOut> keys_result,
+                  device_ptr<ValueOut> values_result) {
+  return thrust::merge_by_key(policy, keys_first1, keys_last1, keys_first2,
+                              keys_last2, values_first1, values_first2,
+                              keys_result, values_result,
+                              std::less<std::iter_value_t<KeyIter1>>());
+}
+
+template <__detail::device_iterator KeyIter1,
+          __detail::device_iterator KeyIter2,
+          __detail::device_iterator ValueIter1,
+          __detail::device_iterator ValueIter2, typename KeyOut,
+          typename ValueOut, typename Compare>
+  requires(std::is_trivially_copyable_v<KeyOut> && !std::is_const_v<KeyOut> &&
+           std::is_trivially_copyable_v<ValueOut> &&
+           !std::is_const_v<ValueOut>)
+std::pair<device_ptr<KeyOut>, device_ptr<ValueOut>>
+merge_by_key(KeyIter1 keys_first1, KeyIter1 keys_last1, KeyIter2 keys_first2,
+             KeyIter2 keys_last2, ValueIter1 values_first1,
+             ValueIter2 values_first2, device_ptr<KeyOut> keys_result,
+             device_ptr<ValueOut> values_result, Compare comp) {
+  execution_policy policy(__detail::get_iterator_queue(keys_first1));
+  return thrust::merge_by_key(policy, keys_first1, keys_last1, keys_first2,
+                              keys_last2, values_first1, values_first2,
+                              keys_result, values_result, comp);
+}
+
+template <__detail::device_iterator KeyIter1,
+          __detail::device_iterator KeyIter2,
+          __detail::device_iterator ValueIter1,
+          __detail::device_iterator ValueIter2, typename KeyOut,
+          typename ValueOut>
+  requires(std::is_trivially_copyable_v<KeyOut> && !std::is_const_v<KeyOut> &&
+           std::is_trivially_copyable_v<ValueOut> &&
+           !std::is_const_v<ValueOut>)
+std::pair<device_ptr<KeyOut>, device_ptr<ValueOut>>
+merge_by_key(KeyIter1 keys_first1, KeyIter1 keys_last1, KeyIter2 keys_first2,
+             KeyIter2 keys_last2, ValueIter1 values_first1,
+             ValueIter2 values_first2, device_ptr<KeyOut> keys_result,
+             device_ptr<ValueOut> values_result) {
+  return thrust::merge_by_key(keys_first1, keys_last1, keys_first2,
+                              keys_last2, values_first1, values_first2,
+                              keys_result, values_result,
+                              std::less<std::iter_value_t<KeyIter1>>());
+}
+
+} // namespace thrust
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/find.hpp>
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// First position at which two ranges of the same length differ, where `pred`
+// decides whether a pair of elements matches.  Returns the pair of iterators
+// to that position, or to the ends if the ranges match.  Under `par_nowait`
+// it returns a `future` holding the offset of that position instead, since a
+// pair of iterators cannot be produced on the device.
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, typename BinaryPredicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto mismatch(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1,
+              Iter2 first2, BinaryPredicate pred) {
+  using T1 = std::iter_value_t<Iter1>;
+  using T2 = std::iter_value_t<Iter2>;
+
+  auto offset = __detail::find_first<std::size_t>(
+      policy, std::distance(first1, last1),
+      [=](std::size_t i) {
+        return !pred(T1(__detail::kernel_reference(first1, i)),
+                     T2(__detail::kernel_reference(first2, i)));
+      },
+      [=](std::size_t i) { return i; });
+
+  if constexpr (__detail::is_nowait_policy_v<ExecutionPolicy>) {
+    return offset;
+  } else {
+    return std::pair{first1 + offset, first2 + offset};
+  }
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto mismatch(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1,
+              Iter2 first2) {
+  return thrust::mismatch(policy, first1, last1, first2, std::equal_to<>());
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          typename BinaryPredicate>
+std::pair<Iter1, Iter2> mismatch(Iter1 first1, Iter1 last1, Iter2 first2,
+                                 BinaryPredicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first1));
+  return thrust::mismatch(policy, first1, last1, first2, pred);
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2>
+std::pair<Iter1, Iter2> mismatch(Iter1 first1, Iter1 last1, Iter2 first2) {
+  return thrust::mismatch(first1, last1, first2, std::equal_to<>());
+}
+
+// Host ranges compared against device ranges are staged in pinned memory and
+// copied to the device a chunk at a time on a queue of their own, so the copy
+// of each chunk runs while the one before is searched, and the copies stop
+// at the first chunk holding a mismatch.  Host memory the device can access
+// directly is not copied at all.  The position is decided on the host, so
+// these overloads block and return the pair of iterators under every policy.
+
+template <typename ExecutionPolicy, std::contiguous_iterator HostIter,
+          __detail::device_iterator Iter, typename BinaryPredicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !__detail::device_iterator<HostIter>)
+std::pair<HostIter, Iter> mismatch(ExecutionPolicy&& policy,
+                                   HostIter first1, HostIter last1,
+                                   Iter first2, BinaryPredicate pred) {
+  std::size_t offset = __detail::mismatch_host_device(
+      policy, std::to_address(first1), first2, std::distance(first1, last1),
+      pred);
+  return {first1 + offset, first2 + offset};
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          std::contiguous_iterator HostIter, typename BinaryPredicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !__detail::device_iterator<HostIter>)
+std::pair<Iter, HostIter> mismatch(ExecutionPolicy&& policy, Iter first1,
+                                   Iter last1, HostIter first2,
+                                   BinaryPredicate pred) {
+  std::size_t offset = __detail::mismatch_host_device(
+      policy, std::to_address(first2), first1, std::distance(first1, last1),
+      [=](const auto& host, const auto& device) { return pred(device, host); });
+  return {first1 + offset, first2 + offset};
+}
+
+template <typename ExecutionPolicy, std::contiguous_iterator HostIter,
+          __detail::device_iterator Iter>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !__detail::device_iterator<HostIter>)
+std::pair<HostIter, Iter> mismatch(ExecutionPolicy&& policy,
+                                   HostIter first1, HostIter last1,
+                                   Iter first2) {
+  return thrust::mismatch(policy, first1, last1, first2, std::equal_to<>());
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          std::contiguous_iterator HostIter>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           !__detail::device_iterator<HostIter>)
+std::pair<Iter, HostIter> mismatch(ExecutionPolicy&& policy, Iter first1,
+                                   Iter last1, HostIter first2) {
+  return thrust::mismatch(policy, first1, last1, first2, std::equal_to<>());
+}
+
+template <std::contiguous_iterator HostIter, __detail::device_iterator Iter,
+          typename BinaryPredicate>
+  requires(!__detail::device_iterator<HostIter>)
+std::pair<HostIter, Iter> mismatch(HostIter first1, HostIter last1,
+                                   Iter first2, BinaryPredicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first2));
+  return thrust::mismatch(policy, first1, last1, first2, pred);
+}
+
+template <__detail::device_iterator Iter, std::contiguous_iterator HostIter,
+          typename BinaryPredicate>
+  requires(!__detail::device_iterator<HostIter>)
+std::pair<Iter, HostIter> mismatch(Iter first1, Iter last1, HostIter first2,
+                                   BinaryPredicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first1));
+  return thrust::mismatch(policy, first1, last1, first2, pred);
+}
+
+template <std::contiguous_iterator HostIter, __detail::device_iterator Iter>
+  requires(!__detail::device_iterator<HostIter>)
+std::pair<HostIter, Iter> mismatch(HostIter first1, HostIter last1,
+                                   Iter first2) {
+  return thrust::mismatch(first1, last1, first2, std::equal_to<>());
+}
+
+template <__detail::device_iterator Iter, std::contiguous_iterator HostIter>
+  requires(!__detail::device_iterator<HostIter>)
+std::pair<Iter, HostIter> mismatch(Iter first1, Iter last1,
+                                   HostIter first2) {
+  return thrust::mismatch(first1, last1, first2, std::equal_to<>());
+}
+
+} // namespace thrust
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/compact.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+
+namespace thrust {
+
+// Reorder the range so that the elements for which `pred` holds come first,
+// keeping the relative order within both groups, and return the partition
+// point.  Selected elements are compacted in place by the scan, while the
+// others are scattered to scratch storage and copied after them by a second
+// kernel that reads the partition point on the device, so nothing waits on
+// the host.  Under `par_nowait` the partition point is returned as a
+// `future`.
+template <typename ExecutionPolicy, typename T, typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+auto stable_partition(ExecutionPolicy&& policy, device_ptr<T> first,
+                      device_ptr<T> last, Predicate pred) {
+  std::size_t n = std::distance(first, last);
+  T* data = first.get();
+
+  __detail::temporary_buffer<T> rejected_buffer(policy, n);
+  T* rejected = rejected_buffer.data();
+
+  sycl::queue& q = policy.get_queue();
+
+  return __detail::compact_impl(
+      policy, n,
+      [=](std::size_t i) {
+        T value = data[i];
+        return __detail::counted_value<T>{pred(value) ? 1u : 0u, value};
+      },
+      __detail::count_op{},
+      [=](std::size_t k, const T& value) { data[k] = value; },
+      [=](std::size_t k, const T& value) { rejected[k] = value; }, first,
+      [&](sycl::event e, const device_ptr<T>* end) {
+        return q.submit([&](sycl::handler& h) {
+          h.depends_on(e);
+          h.parallel_for(sycl::range<1>(n), [=](sycl::id<1> idx) {
+            std::size_t i = idx[0];
+            std::size_t count = end->get() - data;
+            if (i < n - count) {
+              data[count + i] = rejected[i];
+            }
+          });
+        });
+      },
+      std::move(rejected_buffer));
+}
+
+template <typename T, typename Predicate>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+device_ptr<T> stable_partition(device_ptr<T> first, device_ptr<T> last,
+                               Predicate pred) {
+  execution_policy policy(__detail::get_pointer_queue(first.get()));
+  return thrust::stable_partition(policy, first, last, pred);
+}
+
+// Reorder the range so that the elements for which `pred` holds come first,
+// and return the partition point.  This is currently the stable partition.
+template <typename ExecutionPolicy, typename T, typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+auto partition(ExecutionPolicy&& policy, device_ptr<T> first,
+               device_ptr<T> last, Predicate pred) {
+  return thrust::stable_partition(policy, first, last, pred);
+}
+
+template <typename T, typename Predicate>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+device_ptr<T> partition(device_ptr<T> first, device_ptr<T> last,
+                        Predicate pred) {
+  return thrust::stable_partition(first, last, pred);
+}
+
+} // namespace thrust
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <new>
+#include <type_traits>
+
+#include <thrust/detail/default_selector.hpp>
+#include <thrust/detail/get_pointer_device.hpp>
+
+namespace thrust {
+
+// Allocator for page-locked host memory from `sycl::malloc_host`.  Pinned
+// memory is directly accessible to the device, so transfers to and from it
+// need no intermediate staging and can overlap with other work.  Allocations
+// are associated with the device they were requested for, which is where
+// copies involving them are queued.
+template <typename T>
+  requires(std::is_trivially_copyable_v<T>)
+class pinned_allocator {
+public:
+  using value_type = T;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  template <typename U>
+  pinned_allocator(const pinned_allocator<U>& other) noexcept
+      : device_(other.get_device()), context_(other.get_context()) {}
+
+  pinned_allocator() noexcept
+      : pinned_allocator(sycl::queue(thrust::default_selector_v)) {}
+
+  pinned_allocator(const sycl::queue& q) noexcept
+      : device_(q.get_device()), context_(q.get_context()) {}
+  pinned_allocator(const sycl::context& ctxt, const sycl::device& dev) noexcept
+      : device_(dev), context_(ctxt) {}
+
+  pinned_allocator(const pinned_allocator&) = default;
+  pinned_allocator& operator=(const pinned_allocator&) = default;
+  ~pinned_allocator() = default;
+
+  using is_always_equal = std::false_type;
+
+  pointer allocate(std::size_t size) {
+    T* ptr = sycl::malloc_host<T>(size, context_);
+    if (ptr == nullptr && size > 0) {
+      throw std::bad_alloc();
+    }
+    __detail::pointer_registry::instance().register_allocation(
+        ptr, size * sizeof(T), device_, context_);
+    return ptr;
+  }
+
+  void deallocate(pointer ptr, std::size_t n) {
+    __detail::pointer_registry::instance().unregister_allocation(ptr);
+    sycl::free(ptr, context_);
+  }
+
+  bool operator==(const pinned_allocator&) const = default;
+  bool operator!=(const pinned_allocator&) const = default;
+
+  template <typename U>
+  struct rebind {
+    using other = pinned_allocator<U>;
+  };
+
+  sycl::device get_device() const noexcept {
+    return device_;
+  }
+
+  sycl::context get_context() const noexcept {
+    return context_;
+  }
+
+private:
+  sycl::device device_;
+  sycl::context context_;
+};
+
+} // namespace thrust
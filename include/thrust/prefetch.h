@@ -0,0 +1,68 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/execution_policy.h>
+
+namespace thrust {
+
+namespace __detail {
+
+template <std::contiguous_iterator Iter>
+std::size_t range_bytes(Iter first, Iter last) {
+  return std::distance(first, last) * sizeof(std::iter_value_t<Iter>);
+}
+
+} // namespace __detail
+
+// Migrate the shared USM pages backing [first, last) to the policy's device,
+// so kernels that touch them later do not take page faults.
+template <typename ExecutionPolicy, std::contiguous_iterator Iter>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto prefetch(ExecutionPolicy&& policy, Iter first, Iter last) {
+  std::size_t bytes = __detail::range_bytes(first, last);
+  if (bytes == 0) {
+    sycl::event::wait(policy.get_dependencies());
+    return __detail::complete(policy, sycl::event());
+  }
+
+  auto e = policy.get_queue().prefetch(std::to_address(first), bytes,
+                                       policy.get_dependencies());
+  return __detail::complete(policy, e);
+}
+
+template <std::contiguous_iterator Iter>
+void prefetch(Iter first, Iter last) {
+  execution_policy policy(__detail::get_pointer_queue(std::to_address(first)));
+  thrust::prefetch(policy, first, last);
+}
+
+// Pass a memory advice hint for [first, last) to the policy's device.  The
+// meaning of `advice` is defined by the SYCL backend.
+template <typename ExecutionPolicy, std::contiguous_iterator Iter>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto mem_advise(ExecutionPolicy&& policy, Iter first, Iter last, int advice) {
+  std::size_t bytes = __detail::range_bytes(first, last);
+  if (bytes == 0) {
+    sycl::event::wait(policy.get_dependencies());
+    return __detail::complete(policy, sycl::event());
+  }
+
+  auto e = policy.get_queue().mem_advise(std::to_address(first), bytes,
+                                         advice, policy.get_dependencies());
+  return __detail::complete(policy, e);
+}
+
+template <std::contiguous_iterator Iter>
+void mem_advise(Iter first, Iter last, int advice) {
+  execution_policy policy(__detail::get_pointer_queue(std::to_address(first)));
+  thrust::mem_advise(policy, first, last, advice);
+}
+
+} // namespace thrust
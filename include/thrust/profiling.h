@@ -0,0 +1,407 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <source_location>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <thrust/detail/default_selector.hpp>
+#include <thrust/detail/profiling_counters.hpp>
+#include <thrust/execution_policy.h>
+
+namespace thrust {
+
+// Snapshot of the process-wide counters of work sycl-thrust does implicitly.
+struct profiling_counters {
+  // Queues created to run algorithms called without an execution policy.
+  std::uint64_t implicit_queue_creations = 0;
+  // Single elements read or written from the host through
+  // `device_reference`, each a separate transfer, and their total size.
+  std::uint64_t device_reference_reads = 0;
+  std::uint64_t device_reference_writes = 0;
+  std::uint64_t device_reference_bytes = 0;
+};
+
+inline profiling_counters get_profiling_counters() {
+  auto&& counters = __detail::profiling_counters::instance();
+  return {counters.implicit_queue_creations.load(),
+          counters.device_reference_reads.load(),
+          counters.device_reference_writes.load(),
+          counters.device_reference_bytes.load()};
+}
+
+inline void reset_profiling_counters() {
+  auto&& counters = __detail::profiling_counters::instance();
+  counters.implicit_queue_creations = 0;
+  counters.device_reference_reads = 0;
+  counters.device_reference_writes = 0;
+  counters.device_reference_bytes = 0;
+}
+
+enum class transfer_direction {
+  host_to_device,
+  device_to_host,
+  device_to_device
+};
+
+// One sycl-thrust call made under a `profiling_policy`.  Timestamps are in
+// nanoseconds on the device's profiling clock: when the call's first
+// command was submitted, when it started executing, and when the call's
+// last command finished.
+struct profiling_record {
+  std::string label;
+  std::uint64_t submit_ns = 0;
+  std::uint64_t start_ns = 0;
+  std::uint64_t end_ns = 0;
+  std::size_t host_to_device_bytes = 0;
+  std::size_t device_to_host_bytes = 0;
+  std::size_t device_to_device_bytes = 0;
+  // Temporary device and pinned host allocations made by the call.
+  std::size_t allocations = 0;
+  std::size_t allocated_bytes = 0;
+};
+
+namespace __detail {
+
+// Calls recorded by a `profiling_policy` and all of its copies.  A call
+// opens the first time sycl-thrust allocates scratch memory or moves data
+// for it, and closes when sycl-thrust completes it.  Timestamps are read
+// lazily, once the call's work has finished.
+class profiler {
+public:
+  void record_transfer(sycl::queue queue, transfer_direction direction,
+                       std::size_t bytes) {
+    std::lock_guard lock(mutex_);
+    profiling_record& record = begin_call_locked(queue);
+    switch (direction) {
+    case transfer_direction::host_to_device:
+      record.host_to_device_bytes += bytes;
+      break;
+    case transfer_direction::device_to_host:
+      record.device_to_host_bytes += bytes;
+      break;
+    case transfer_direction::device_to_device:
+      record.device_to_device_bytes += bytes;
+      break;
+    }
+  }
+
+  void record_allocation(sycl::queue queue, std::size_t bytes) {
+    std::lock_guard lock(mutex_);
+    profiling_record& record = begin_call_locked(queue);
+    record.allocations++;
+    record.allocated_bytes += bytes;
+  }
+
+  // Close the call labeled `label`, whose last command is `e`, or which did
+  // no device work if `e` is null.  Calls without device work are not
+  // recorded, and calls made as steps of another do not close it.
+  void end_call(const sycl::event* e, const std::string& label) {
+    std::lock_guard lock(mutex_);
+    if (nesting_ > 0) {
+      return;
+    }
+    if (e != nullptr) {
+      call& closed = open_ ? *open_ : open_.emplace();
+      closed.record.label = label;
+      closed.end = *e;
+      calls_.push_back(std::move(closed));
+    }
+    open_.reset();
+  }
+
+  void begin_nested_call() {
+    std::lock_guard lock(mutex_);
+    nesting_++;
+  }
+
+  void end_nested_call() {
+    std::lock_guard lock(mutex_);
+    nesting_--;
+  }
+
+  // Records of all closed calls, waiting for any still running.
+  std::vector<profiling_record> records() {
+    using namespace sycl::info::event_profiling;
+
+    std::lock_guard lock(mutex_);
+    std::vector<profiling_record> records;
+    for (auto&& call : calls_) {
+      call.end.wait();
+      profiling_record record = call.record;
+      sycl::event& first = call.begin ? *call.begin : call.end;
+      record.submit_ns = first.get_profiling_info<command_submit>();
+      record.start_ns = first.get_profiling_info<command_start>();
+      record.end_ns = call.end.get_profiling_info<command_end>();
+      records.push_back(std::move(record));
+    }
+    return records;
+  }
+
+  void clear() {
+    std::lock_guard lock(mutex_);
+    calls_.clear();
+  }
+
+private:
+  struct call {
+    profiling_record record;
+    std::optional<sycl::event> begin;
+    sycl::event end;
+  };
+
+  profiling_record& begin_call_locked(sycl::queue& queue) {
+    if (!open_) {
+      open_.emplace();
+#ifdef SYCL_EXT_ONEAPI_ENQUEUE_BARRIER
+      // The queue is in order, so this marker starts once the previous call
+      // has finished and this call's first command starts right after it.
+      open_->begin = queue.ext_oneapi_submit_barrier();
+#endif
+    }
+    return open_->record;
+  }
+
+  std::mutex mutex_;
+  std::optional<call> open_;
+  std::vector<call> calls_;
+  std::size_t nesting_ = 0;
+};
+
+inline void write_json_string(std::ostream& os, std::string_view s) {
+  os << '"';
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      os << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      os << ' ';
+    } else {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
+} // namespace __detail
+
+// Blocking policy that records the timing, data movement and scratch
+// allocations of every sycl-thrust call made under it or its copies.  It
+// runs on its own in-order queue with `enable_profiling`, so calls execute
+// one after another.  A call is timed from its first allocation or
+// transfer, or failing that from the start of its last command, to the end
+// of its last command.  Label calls with `named` or `here` to tell call
+// sites apart.  Copies share one set of records, and calls under them
+// should not be made from several threads at once.
+class profiling_policy : public execution_policy {
+public:
+  profiling_policy()
+      : profiling_policy(sycl::queue(thrust::default_selector_v)) {}
+
+  // Profiles work on the device and context of `queue`.
+  explicit profiling_policy(const sycl::queue& queue)
+      : execution_policy(
+            sycl::queue(queue.get_context(), queue.get_device(),
+                        {sycl::property::queue::enable_profiling(),
+                         sycl::property::queue::in_order()})),
+        profiler_(std::make_shared<__detail::profiler>()) {}
+
+  template <typename... Events>
+  profiling_policy after(const Events&... events) const {
+    profiling_policy policy(*this);
+    (policy.dependencies_.push_back(sycl::event(events)), ...);
+    return policy;
+  }
+
+  template <typename Allocator>
+  profiling_policy operator()(const Allocator& allocator) const {
+    profiling_policy policy(*this);
+    policy.use_allocator_(allocator);
+    return policy;
+  }
+
+  // Copy that profiles work on the device and context of `queue`, still on
+  // an in-order profiling queue of its own, and adds to the same records.
+  profiling_policy on(const sycl::queue& queue) const {
+    profiling_policy policy(*this);
+    policy.queue_ = sycl::queue(queue.get_context(), queue.get_device(),
+                                {sycl::property::queue::enable_profiling(),
+                                 sycl::property::queue::in_order()});
+    return policy;
+  }
+
+  profiling_policy with_scratch_arena(std::size_t initial_bytes = 0) const {
+    profiling_policy policy(*this);
+    policy.use_scratch_arena_(initial_bytes);
+    return policy;
+  }
+
+  profiling_policy with_transfer_chunk_size(std::size_t bytes) const {
+    profiling_policy policy(*this);
+    policy.transfer_chunk_size_ = bytes;
+    return policy;
+  }
+
+  // Copy whose calls are recorded under `label`.
+  profiling_policy named(std::string label) const {
+    profiling_policy policy(*this);
+    policy.label_ = std::move(label);
+    return policy;
+  }
+
+  // Copy whose calls are labeled with the file and line it is called from.
+  profiling_policy
+  here(std::source_location location = std::source_location::current()) const {
+    return named(std::string(location.file_name()) + ":" +
+                 std::to_string(location.line()));
+  }
+
+  // Records of the calls made so far, in order, once they have finished.
+  std::vector<profiling_record> records() const {
+    return profiler_->records();
+  }
+
+  void clear() const {
+    profiler_->clear();
+  }
+
+  // Write the records as Chrome trace events, viewable in chrome://tracing
+  // or Perfetto, with times relative to the first call's submission.
+  void write_chrome_trace(std::ostream& os) const {
+    std::vector<profiling_record> records = this->records();
+
+    std::uint64_t origin = records.empty() ? 0 : records[0].submit_ns;
+    for (auto&& record : records) {
+      origin = std::min(origin, record.submit_ns);
+    }
+    auto microseconds = [&](std::uint64_t ns) { return (ns - origin) / 1e3; };
+
+    auto flags = os.flags();
+    os << std::fixed;
+    os << "{\"traceEvents\": [";
+    for (std::size_t i = 0; i < records.size(); i++) {
+      auto&& record = records[i];
+      std::uint64_t end_ns = std::max(record.end_ns, record.start_ns);
+
+      os << (i == 0 ? "\n" : ",\n") << "  {\"name\": ";
+      __detail::write_json_string(os, record.label.empty() ? "sycl-thrust"
+                                                           : record.label);
+      os << ", \"cat\": \"sycl-thrust\", \"ph\": \"X\", \"pid\": 0, "
+         << "\"tid\": 0, \"ts\": " << microseconds(record.start_ns)
+         << ", \"dur\": " << (end_ns - record.start_ns) / 1e3
+         << ", \"args\": {\"submit_us\": " << microseconds(record.submit_ns)
+         << ", \"host_to_device_bytes\": " << record.host_to_device_bytes
+         << ", \"device_to_host_bytes\": " << record.device_to_host_bytes
+         << ", \"device_to_device_bytes\": " << record.device_to_device_bytes
+         << ", \"allocations\": " << record.allocations
+         << ", \"allocated_bytes\": " << record.allocated_bytes << "}}";
+    }
+    os << "\n]}\n";
+    os.flags(flags);
+  }
+
+  void write_chrome_trace(const std::string& path) const {
+    std::ofstream os(path);
+    if (!os) {
+      throw std::runtime_error("write_chrome_trace: could not open " + path);
+    }
+    write_chrome_trace(os);
+  }
+
+  // Hooks through which sycl-thrust reports a call's work.
+  void record_transfer(transfer_direction direction, std::size_t bytes) const {
+    profiler_->record_transfer(queue_, direction, bytes);
+  }
+
+  void record_allocation(std::size_t bytes) const {
+    profiler_->record_allocation(queue_, bytes);
+  }
+
+  void end_call(const sycl::event* e) const {
+    profiler_->end_call(e, label_);
+  }
+
+  void begin_nested_call() const {
+    profiler_->begin_nested_call();
+  }
+
+  void end_nested_call() const {
+    profiler_->end_nested_call();
+  }
+
+private:
+  std::shared_ptr<__detail::profiler> profiler_;
+  std::string label_;
+};
+
+namespace __detail {
+
+template <typename ExecutionPolicy>
+inline constexpr bool is_profiling_policy_v =
+    std::is_base_of_v<profiling_policy, std::remove_cvref_t<ExecutionPolicy>>;
+
+template <typename ExecutionPolicy>
+void profile_transfer(ExecutionPolicy&& policy, transfer_direction direction,
+                      std::size_t bytes) {
+  if constexpr (is_profiling_policy_v<ExecutionPolicy>) {
+    policy.record_transfer(direction, bytes);
+  }
+}
+
+template <typename ExecutionPolicy>
+void profile_allocation(ExecutionPolicy&& policy, std::size_t bytes) {
+  if constexpr (is_profiling_policy_v<ExecutionPolicy>) {
+    policy.record_allocation(bytes);
+  }
+}
+
+// Close the call in progress under `policy`, whose last command is `e`, or
+// which did no device work if `e` is null.
+template <typename ExecutionPolicy>
+void profile_completion(ExecutionPolicy&& policy, const sycl::event* e) {
+  if constexpr (is_profiling_policy_v<ExecutionPolicy>) {
+    policy.end_call(e);
+  }
+}
+
+// Scope in which an algorithm runs another under `policy` as one of its
+// steps, so that the inner call's work is recorded as part of the outer
+// call rather than closing it.
+template <typename ExecutionPolicy>
+class nested_call_scope {
+public:
+  explicit nested_call_scope(const ExecutionPolicy& policy) : policy_(policy) {
+    if constexpr (is_profiling_policy_v<ExecutionPolicy>) {
+      policy_.begin_nested_call();
+    }
+  }
+
+  nested_call_scope(const nested_call_scope&) = delete;
+  nested_call_scope& operator=(const nested_call_scope&) = delete;
+
+  ~nested_call_scope() {
+    if constexpr (is_profiling_policy_v<ExecutionPolicy>) {
+      policy_.end_nested_call();
+    }
+  }
+
+private:
+  const ExecutionPolicy& policy_;
+};
+
+} // namespace __detail
+
+} // namespace thrust
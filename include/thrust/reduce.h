@@ -0,0 +1,375 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/group_reduce.hpp>
+#include <thrust/detail/kernel_config.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/scan.hpp>
+#include <thrust/detail/segmented_reduce.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+namespace __detail {
+
+// Two-pass reduction.  A grid-stride kernel reduces the input to one partial
+// per work-group, then a single work-group reduces the partials and folds in
+// `init`.  `binary_op` must be associative and commutative.
+template <typename ExecutionPolicy, typename Iter, typename UnaryOp, typename T,
+          typename BinaryOp>
+auto transform_reduce_impl(ExecutionPolicy&& policy, Iter first, std::size_t n,
+                           UnaryOp unary_op, T init, BinaryOp binary_op) {
+  using value_type = std::iter_value_t<Iter>;
+
+  if (n == 0) {
+    sycl::event::wait(policy.get_dependencies());
+    return ready_value(policy, init);
+  }
+
+  sycl::queue& q = policy.get_queue();
+  std::size_t wg_size = work_group_size(q);
+  std::size_t num_groups = num_work_groups(q, n, wg_size);
+
+  temporary_buffer<T> partials(policy, num_groups + 1);
+  T* partials_ptr = partials.data();
+  T* result = partials_ptr + num_groups;
+
+  auto reduce_event = q.submit([&](sycl::handler& h) {
+    h.depends_on(policy.get_dependencies());
+    sycl::local_accessor<T, 1> scratch(wg_size, h);
+
+    h.parallel_for(
+        sycl::nd_range<1>(num_groups * wg_size, wg_size),
+        [=](sycl::nd_item<1> item) {
+          std::size_t gid = item.get_global_id(0);
+          std::size_t stride = item.get_global_range(0);
+          std::size_t group_first = item.get_group_linear_id() * wg_size;
+
+          // Work-items past the end load a duplicate that group_reduce
+          // ignores, so no identity element is needed.
+          T value = unary_op(value_type(first[std::min(gid, n - 1)]));
+          for (std::size_t i = gid + stride; i < n; i += stride) {
+            value = binary_op(value, unary_op(value_type(first[i])));
+          }
+
+          T total = group_reduce(item, scratch, value,
+                                 std::min(wg_size, n - group_first), binary_op);
+
+          if (item.get_local_id(0) == 0) {
+            partials_ptr[item.get_group_linear_id()] = total;
+          }
+        });
+  });
+
+  auto final_event = q.submit([&](sycl::handler& h) {
+    h.depends_on(reduce_event);
+    sycl::local_accessor<T, 1> scratch(wg_size, h);
+
+    h.parallel_for(sycl::nd_range<1>(wg_size, wg_size),
+                   [=](sycl::nd_item<1> item) {
+                     std::size_t lid = item.get_local_id(0);
+
+                     T value = partials_ptr[std::min(lid, num_groups - 1)];
+                     for (std::size_t i = lid + wg_size; i < num_groups;
+                          i += wg_size) {
+                       value = binary_op(value, partials_ptr[i]);
+                     }
+
+                     T total = group_reduce(item, scratch, value,
+                                            std::min(wg_size, num_groups),
+                                            binary_op);
+
+                     if (lid == 0) {
+                       *result = binary_op(init, total);
+                     }
+                   });
+  });
+
+  return complete_value(policy, final_event, result, std::move(partials));
+}
+
+} // namespace __detail
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          typename UnaryOp, typename U, typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U>)
+auto transform_reduce(ExecutionPolicy&& policy, Iter first, Iter last,
+                      UnaryOp unary_op, U init, BinaryOp binary_op) {
+  return __detail::transform_reduce_impl(policy, first,
+                                         std::distance(first, last), unary_op,
+                                         init, binary_op);
+}
+
+template <__detail::device_iterator Iter, typename UnaryOp, typename U,
+          typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U>)
+U transform_reduce(Iter first, Iter last, UnaryOp unary_op, U init,
+                   BinaryOp binary_op) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::transform_reduce(policy, first, last, unary_op, init,
+                                  binary_op);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter, typename U,
+          typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U>)
+auto reduce(ExecutionPolicy&& policy, Iter first, Iter last, U init,
+            BinaryOp binary_op) {
+  return thrust::transform_reduce(
+      policy, first, last,
+      [](const std::iter_value_t<Iter>& x) { return x; }, init, binary_op);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter, typename U>
+  requires(std::is_trivially_copyable_v<U>)
+auto reduce(ExecutionPolicy&& policy, Iter first, Iter last, U init) {
+  return thrust::reduce(policy, first, last, init, std::plus<U>());
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter>
+  requires(std::is_trivially_copyable_v<std::iter_value_t<Iter>>)
+auto reduce(ExecutionPolicy&& policy, Iter first, Iter last) {
+  return thrust::reduce(policy, first, last, std::iter_value_t<Iter>{});
+}
+
+template <__detail::device_iterator Iter, typename U, typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U>)
+U reduce(Iter first, Iter last, U init, BinaryOp binary_op) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::reduce(policy, first, last, init, binary_op);
+}
+
+template <__detail::device_iterator Iter, typename U>
+  requires(std::is_trivially_copyable_v<U>)
+U reduce(Iter first, Iter last, U init) {
+  return thrust::reduce(first, last, init, std::plus<U>());
+}
+
+template <__detail::device_iterator Iter>
+  requires(std::is_trivially_copyable_v<std::iter_value_t<Iter>>)
+std::iter_value_t<Iter> reduce(Iter first, Iter last) {
+  return thrust::reduce(first, last, std::iter_value_t<Iter>{});
+}
+
+// Reduce each run of consecutive equivalent keys to one key and the
+// reduction of its values.  This is a single scan whose operator carries the
+// number of runs and the reduction of the current run, and each run's result
+// is written when the scan reaches the start of the next run.  Returns the
+// ends of the two outputs, or under `par_nowait` a `future` holding the
+// number of runs.
+template <typename ExecutionPolicy, __detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename KeyOut,
+          typename ValueOut, typename BinaryPredicate, typename BinaryOp>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<KeyOut> && !std::is_const_v<KeyOut> &&
+           std::is_trivially_copyable_v<ValueOut> &&
+           !std::is_const_v<ValueOut>)
+auto reduce_by_key(ExecutionPolicy&& policy, KeyIter keys_first,
+                   KeyIter keys_last, ValueIter values_first,
+                   device_ptr<KeyOut> keys_output,
+                   device_ptr<ValueOut> values_output,
+                   BinaryPredicate binary_pred, BinaryOp binary_op) {
+  using key_type = std::iter_value_t<KeyIter>;
+  using value_type = std::iter_value_t<ValueIter>;
+  using run_type = __detail::keyed_run<key_type, value_type>;
+
+  std::size_t n = std::distance(keys_first, keys_last);
+  KeyOut* keys_out = keys_output.get();
+  ValueOut* values_out = values_output.get();
+
+  auto count = [&] {
+    if (n == 0) {
+      sycl::event::wait(policy.get_dependencies());
+      return __detail::ready_value(policy, std::size_t(0));
+    }
+
+    __detail::temporary_buffer<std::size_t> count_buffer(policy, 1);
+    std::size_t* count_ptr = count_buffer.data();
+
+    auto [e, storage] = __detail::submit_scan(
+        policy, n,
+        [=](std::size_t i) {
+          key_type key(keys_first[i]);
+          return run_type{1, key, key, value_type(values_first[i])};
+        },
+        __detail::keyed_run_op<BinaryPredicate, BinaryOp>{binary_pred,
+                                                          binary_op},
+        [=](std::size_t i, const run_type& incl, bool has_prev,
+            const run_type& prev) {
+          if (!has_prev || incl.count != prev.count) {
+            keys_out[incl.count - 1] = incl.last_key;
+            if (has_prev) {
+              values_out[prev.count - 1] = prev.value;
+            }
+          }
+          if (i == n - 1) {
+            values_out[incl.count - 1] = incl.value;
+            *count_ptr = incl.count;
+          }
+        });
+
+    return __detail::complete_value<std::size_t>(
+        policy, e, count_ptr, std::move(count_buffer), std::move(storage));
+  }();
+
+  if constexpr (__detail::is_nowait_policy_v<ExecutionPolicy>) {
+    return count;
+  } else {
+    return std::pair{keys_output + count, values_output + count};
+  }
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename KeyOut,
+          typename ValueOut, typename BinaryPredicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<KeyOut> && !std::is_const_v<KeyOut> &&
+           std::is_trivially_copyable_v<ValueOut> &&
+           !std::is_const_v<ValueOut>)
+auto reduce_by_key(ExecutionPolicy&& policy, KeyIter keys_first,
+                   KeyIter keys_last, ValueIter values_first,
+                   device_ptr<KeyOut> keys_output,
+                   device_ptr<ValueOut> values_output,
+                   BinaryPredicate binary_pred) {
+  return thrust::reduce_by_key(policy, keys_first, keys_last, values_first,
+                               keys_output, values_output, binary_pred,
+                               std::plus<std::iter_value_t<ValueIter>>());
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename KeyOut,
+          typename ValueOut>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<KeyOut> && !std::is_const_v<KeyOut> &&
+           std::is_trivially_copyable_v<ValueOut> &&
+           !std::is_const_v<ValueOut>)
+auto reduce_by_key(ExecutionPolicy&& policy, KeyIter keys_first,
+                   KeyIter keys_last, ValueIter values_first,
+                   device_ptr<KeyOut> keys_output,
+                   device_ptr<ValueOut> values_output) {
+  return thrust::reduce_by_key(policy, keys_first, keys_last, values_first,
+                               keys_output, values_output,
+                               std::equal_to<std::iter_value_t<KeyIter>>());
+}
+
+template <__detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename KeyOut,
+          typename ValueOut, typename BinaryPredicate, typename BinaryOp>
+  requires(std::is_trivially_copyable_v<KeyOut> && !std::is_const_v<KeyOut> &&
+           std::is_trivially_copyable_v<ValueOut> &&
+           !std::is_const_v<ValueOut>)
+std::pair<device_ptr<KeyOut>, device_ptr<ValueOut>>
+reduce_by_key(KeyIter keys_first, KeyIter keys_last, ValueIter values_first,
+              device_ptr<KeyOut> keys_output,
+              device_ptr<ValueOut> values_output, BinaryPredicate binary_pred,
+              BinaryOp binary_op) {
+  execution_policy policy(__detail::get_iterator_queue(keys_first));
+  return thrust::reduce_by_key(policy, keys_first, keys_last, values_first,
+                               keys_output, values_output, binary_pred,
+                               binary_op);
+}
+
+template <__detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename KeyOut,
+          typename ValueOut, typename BinaryPredicate>
+  requires(std::is_trivially_copyable_v<KeyOut> && !std::is_const_v<KeyOut> &&
+           std::is_trivially_copyable_v<ValueOut> &&
+           !std::is_const_v<ValueOut>)
+std::pair<device_ptr<KeyOut>, device_ptr<ValueOut>>
+reduce_by_key(KeyIter keys_first, KeyIter keys_last, ValueIter values_first,
+              device_ptr<KeyOut> keys_output,
+              device_ptr<ValueOut> values_output,
+              BinaryPredicate binary_pred) {
+  return thrust::reduce_by_key(keys_first, keys_last, values_first,
+                               keys_output, values_output, binary_pred,
+                               std::plus<std::iter_value_t<ValueIter>>());
+}
+
+template <__detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename KeyOut,
+          typename ValueOut>
+  requires(std::is_trivially_copyable_v<KeyOut> && !std::is_const_v<KeyOut> &&
+           std::is_trivially_copyable_v<ValueOut> &&
+           !std::is_const_v<ValueOut>)
+std::pair<device_ptr<KeyOut>, device_ptr<ValueOut>>
+reduce_by_key(KeyIter keys_first, KeyIter keys_last, ValueIter values_first,
+              device_ptr<KeyOut> keys_output,
+              device_ptr<ValueOut> values_output) {
+  return thrust::reduce_by_key(keys_first, keys_last, values_first,
+                               keys_output, values_output,
+                               std::equal_to<std::iter_value_t<KeyIter>>());
+}
+
+// Reduce each segment of a CSR-style layout: segment s covers elements
+// [offsets[s], offsets[s + 1]) of the input, and its reduction, starting
+// from `init`, is written to result[s].  Empty segments produce `init`.
+// Segments are reduced by a work-item, a sub-group or a work-group depending
+// on their length, so very uneven segment lengths stay load balanced.
+// `binary_op` must be associative and commutative.
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator OffsetIter, typename U, typename T,
+          typename BinaryOp>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto segmented_reduce(ExecutionPolicy&& policy, Iter first,
+                      OffsetIter offsets_first, OffsetIter offsets_last,
+                      device_ptr<U> result, T init, BinaryOp binary_op) {
+  std::size_t num_offsets = std::distance(offsets_first, offsets_last);
+  if (num_offsets <= 1) {
+    sycl::event::wait(policy.get_dependencies());
+    return __detail::complete(policy, sycl::event());
+  }
+
+  auto [e, bins] = __detail::submit_segmented_reduce(
+      policy, first, offsets_first, num_offsets - 1, result.get(), init,
+      binary_op);
+  return __detail::complete(policy, e, std::move(bins));
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator OffsetIter, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto segmented_reduce(ExecutionPolicy&& policy, Iter first,
+                      OffsetIter offsets_first, OffsetIter offsets_last,
+                      device_ptr<U> result) {
+  using value_type = std::iter_value_t<Iter>;
+  return thrust::segmented_reduce(policy, first, offsets_first, offsets_last,
+                                  result, value_type{},
+                                  std::plus<value_type>());
+}
+
+template <__detail::device_iterator Iter,
+          __detail::device_iterator OffsetIter, typename U, typename T,
+          typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+void segmented_reduce(Iter first, OffsetIter offsets_first,
+                      OffsetIter offsets_last, device_ptr<U> result, T init,
+                      BinaryOp binary_op) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::segmented_reduce(policy, first, offsets_first, offsets_last, result,
+                           init, binary_op);
+}
+
+template <__detail::device_iterator Iter,
+          __detail::device_iterator OffsetIter, typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+void segmented_reduce(Iter first, OffsetIter offsets_first,
+                      OffsetIter offsets_last, device_ptr<U> result) {
+  using value_type = std::iter_value_t<Iter>;
+  thrust::segmented_reduce(first, offsets_first, offsets_last, result,
+                           value_type{}, std::plus<value_type>());
+}
+
+} // namespace thrust
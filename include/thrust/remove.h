@@ -0,0 +1,43 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/compact.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Remove the elements for which `pred` holds, keeping the order of the rest,
+// and return the new end of the range.  Under `par_nowait` the end is
+// returned as a `future`.
+template <typename ExecutionPolicy, typename T, typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+auto remove_if(ExecutionPolicy&& policy, device_ptr<T> first,
+               device_ptr<T> last, Predicate pred) {
+  T* data = first.get();
+
+  return __detail::compact_impl(
+      policy, std::distance(first, last),
+      [=](std::size_t i) {
+        T value = data[i];
+        return __detail::counted_value<T>{pred(value) ? 0u : 1u, value};
+      },
+      __detail::count_op{},
+      [=](std::size_t k, const T& value) { data[k] = value; }, first);
+}
+
+template <typename T, typename Predicate>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+device_ptr<T> remove_if(device_ptr<T> first, device_ptr<T> last,
+                        Predicate pred) {
+  execution_policy policy(__detail::get_pointer_queue(first.get()));
+  return thrust::remove_if(policy, first, last, pred);
+}
+
+} // namespace thrust
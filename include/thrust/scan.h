@@ -0,0 +1,310 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/scan.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter, typename U,
+          typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto inclusive_scan(ExecutionPolicy&& policy, Iter first, Iter last,
+                    device_ptr<U> result, BinaryOp binary_op) {
+  using value_type = std::iter_value_t<Iter>;
+  U* out = result.get();
+
+  return __detail::scan_impl(
+      policy, std::distance(first, last),
+      [=](std::size_t i) { return value_type(first[i]); }, binary_op,
+      [=](std::size_t i, const value_type& incl, bool, const value_type&) {
+        out[i] = incl;
+      });
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter, typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto inclusive_scan(ExecutionPolicy&& policy, Iter first, Iter last,
+                    device_ptr<U> result) {
+  return thrust::inclusive_scan(policy, first, last, result,
+                                std::plus<std::iter_value_t<Iter>>());
+}
+
+template <__detail::device_iterator Iter, typename U, typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+void inclusive_scan(Iter first, Iter last, device_ptr<U> result,
+                    BinaryOp binary_op) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::inclusive_scan(policy, first, last, result, binary_op);
+}
+
+template <__detail::device_iterator Iter, typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+void inclusive_scan(Iter first, Iter last, device_ptr<U> result) {
+  thrust::inclusive_scan(first, last, result,
+                         std::plus<std::iter_value_t<Iter>>());
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter, typename U,
+          typename V, typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U> &&
+           std::is_trivially_copyable_v<V>)
+auto exclusive_scan(ExecutionPolicy&& policy, Iter first, Iter last,
+                    device_ptr<U> result, V init, BinaryOp binary_op) {
+  U* out = result.get();
+
+  return __detail::scan_impl(
+      policy, std::distance(first, last),
+      [=](std::size_t i) { return V(std::iter_value_t<Iter>(first[i])); },
+      binary_op, [=](std::size_t i, const V&, bool has_prev, const V& prev) {
+        out[i] = has_prev ? binary_op(init, prev) : init;
+      });
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter, typename U,
+          typename V>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U> &&
+           std::is_trivially_copyable_v<V>)
+auto exclusive_scan(ExecutionPolicy&& policy, Iter first, Iter last,
+                    device_ptr<U> result, V init) {
+  return thrust::exclusive_scan(policy, first, last, result, init,
+                                std::plus<V>());
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter, typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto exclusive_scan(ExecutionPolicy&& policy, Iter first, Iter last,
+                    device_ptr<U> result) {
+  return thrust::exclusive_scan(policy, first, last, result,
+                                std::iter_value_t<Iter>{});
+}
+
+template <__detail::device_iterator Iter, typename U, typename V,
+          typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U> &&
+           std::is_trivially_copyable_v<V>)
+void exclusive_scan(Iter first, Iter last, device_ptr<U> result, V init,
+                    BinaryOp binary_op) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::exclusive_scan(policy, first, last, result, init, binary_op);
+}
+
+template <__detail::device_iterator Iter, typename U, typename V>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U> &&
+           std::is_trivially_copyable_v<V>)
+void exclusive_scan(Iter first, Iter last, device_ptr<U> result, V init) {
+  thrust::exclusive_scan(first, last, result, init, std::plus<V>());
+}
+
+template <__detail::device_iterator Iter, typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+void exclusive_scan(Iter first, Iter last, device_ptr<U> result) {
+  thrust::exclusive_scan(first, last, result, std::iter_value_t<Iter>{});
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U,
+          typename BinaryPredicate, typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto inclusive_scan_by_key(ExecutionPolicy&& policy, KeyIter keys_first,
+                           KeyIter keys_last, ValueIter values_first,
+                           device_ptr<U> result, BinaryPredicate binary_pred,
+                           BinaryOp binary_op) {
+  using key_type = std::iter_value_t<KeyIter>;
+  using value_type = __detail::flagged_value<std::iter_value_t<ValueIter>>;
+  U* out = result.get();
+
+  return __detail::scan_impl(
+      policy, std::distance(keys_first, keys_last),
+      [=](std::size_t i) {
+        bool head = i == 0 || !binary_pred(key_type(keys_first[i - 1]),
+                                           key_type(keys_first[i]));
+        return value_type{head,
+                          std::iter_value_t<ValueIter>(values_first[i])};
+      },
+      __detail::segmented_op<BinaryOp>{binary_op},
+      [=](std::size_t i, const value_type& incl, bool, const value_type&) {
+        out[i] = incl.value;
+      });
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U,
+          typename BinaryPredicate>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto inclusive_scan_by_key(ExecutionPolicy&& policy, KeyIter keys_first,
+                           KeyIter keys_last, ValueIter values_first,
+                           device_ptr<U> result, BinaryPredicate binary_pred) {
+  return thrust::inclusive_scan_by_key(
+      policy, keys_first, keys_last, values_first, result, binary_pred,
+      std::plus<std::iter_value_t<ValueIter>>());
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto inclusive_scan_by_key(ExecutionPolicy&& policy, KeyIter keys_first,
+                           KeyIter keys_last, ValueIter values_first,
+                           device_ptr<U> result) {
+  return thrust::inclusive_scan_by_key(
+      policy, keys_first, keys_last, values_first, result,
+      std::equal_to<std::iter_value_t<KeyIter>>());
+}
+
+template <__detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U,
+          typename BinaryPredicate, typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+void inclusive_scan_by_key(KeyIter keys_first, KeyIter keys_last,
+                           ValueIter values_first, device_ptr<U> result,
+                           BinaryPredicate binary_pred, BinaryOp binary_op) {
+  execution_policy policy(__detail::get_iterator_queue(keys_first));
+  thrust::inclusive_scan_by_key(policy, keys_first, keys_last, values_first,
+                                result, binary_pred, binary_op);
+}
+
+template <__detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U,
+          typename BinaryPredicate>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+void inclusive_scan_by_key(KeyIter keys_first, KeyIter keys_last,
+                           ValueIter values_first, device_ptr<U> result,
+                           BinaryPredicate binary_pred) {
+  thrust::inclusive_scan_by_key(keys_first, keys_last, values_first, result,
+                                binary_pred,
+                                std::plus<std::iter_value_t<ValueIter>>());
+}
+
+template <__detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+void inclusive_scan_by_key(KeyIter keys_first, KeyIter keys_last,
+                           ValueIter values_first, device_ptr<U> result) {
+  thrust::inclusive_scan_by_key(keys_first, keys_last, values_first, result,
+                                std::equal_to<std::iter_value_t<KeyIter>>());
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U, typename V,
+          typename BinaryPredicate, typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U> &&
+           std::is_trivially_copyable_v<V>)
+auto exclusive_scan_by_key(ExecutionPolicy&& policy, KeyIter keys_first,
+                           KeyIter keys_last, ValueIter values_first,
+                           device_ptr<U> result, V init,
+                           BinaryPredicate binary_pred, BinaryOp binary_op) {
+  using key_type = std::iter_value_t<KeyIter>;
+  using value_type = __detail::flagged_value<V>;
+  U* out = result.get();
+
+  auto is_head = [=](std::size_t i) {
+    return i == 0 || !binary_pred(key_type(keys_first[i - 1]),
+                                  key_type(keys_first[i]));
+  };
+
+  return __detail::scan_impl(
+      policy, std::distance(keys_first, keys_last),
+      [=](std::size_t i) {
+        return value_type{is_head(i),
+                          V(std::iter_value_t<ValueIter>(values_first[i]))};
+      },
+      __detail::segmented_op<BinaryOp>{binary_op},
+      [=](std::size_t i, const value_type&, bool, const value_type& prev) {
+        out[i] = is_head(i) ? init : binary_op(init, prev.value);
+      });
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U, typename V,
+          typename BinaryPredicate>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U> &&
+           std::is_trivially_copyable_v<V>)
+auto exclusive_scan_by_key(ExecutionPolicy&& policy, KeyIter keys_first,
+                           KeyIter keys_last, ValueIter values_first,
+                           device_ptr<U> result, V init,
+                           BinaryPredicate binary_pred) {
+  return thrust::exclusive_scan_by_key(policy, keys_first, keys_last,
+                                       values_first, result, init, binary_pred,
+                                       std::plus<V>());
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U, typename V>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U> &&
+           std::is_trivially_copyable_v<V>)
+auto exclusive_scan_by_key(ExecutionPolicy&& policy, KeyIter keys_first,
+                           KeyIter keys_last, ValueIter values_first,
+                           device_ptr<U> result, V init) {
+  return thrust::exclusive_scan_by_key(
+      policy, keys_first, keys_last, values_first, result, init,
+      std::equal_to<std::iter_value_t<KeyIter>>());
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto exclusive_scan_by_key(ExecutionPolicy&& policy, KeyIter keys_first,
+                           KeyIter keys_last, ValueIter values_first,
+                           device_ptr<U> result) {
+  return thrust::exclusive_scan_by_key(policy, keys_first, keys_last,
+                                       values_first, result,
+                                       std::iter_value_t<ValueIter>{});
+}
+
+template <__detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U, typename V,
+          typename BinaryPredicate, typename BinaryOp>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U> &&
+           std::is_trivially_copyable_v<V>)
+void exclusive_scan_by_key(KeyIter keys_first, KeyIter keys_last,
+                           ValueIter values_first, device_ptr<U> result,
+                           V init, BinaryPredicate binary_pred,
+                           BinaryOp binary_op) {
+  execution_policy policy(__detail::get_iterator_queue(keys_first));
+  thrust::exclusive_scan_by_key(policy, keys_first, keys_last, values_first,
+                                result, init, binary_pred, binary_op);
+}
+
+template <__detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U, typename V,
+          typename BinaryPredicate>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U> &&
+           std::is_trivially_copyable_v<V>)
+void exclusive_scan_by_key(KeyIter keys_first, KeyIter keys_last,
+                           ValueIter values_first, device_ptr<U> result,
+                           V init, BinaryPredicate binary_pred) {
+  thrust::exclusive_scan_by_key(keys_first, keys_last, values_first, result,
+                                init, binary_pred, std::plus<V>());
+}
+
+template <__detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U, typename V>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U> &&
+           std::is_trivially_copyable_v<V>)
+void exclusive_scan_by_key(KeyIter keys_first, KeyIter keys_last,
+                           ValueIter values_first, device_ptr<U> result,
+                           V init) {
+  thrust::exclusive_scan_by_key(keys_first, keys_last, values_first, result,
+                                init,
+                                std::equal_to<std::iter_value_t<KeyIter>>());
+}
+
+template <__detail::device_iterator KeyIter,
+          __detail::device_iterator ValueIter, typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+void exclusive_scan_by_key(KeyIter keys_first, KeyIter keys_last,
+                           ValueIter values_first, device_ptr<U> result) {
+  thrust::exclusive_scan_by_key(keys_first, keys_last, values_first, result,
+                                std::iter_value_t<ValueIter>{});
+}
+
+} // namespace thrust
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+
+namespace thrust {
+
+// Fill [first, last) with init, init + step, init + 2 * step, ...  Every
+// element is computed from its index, so unlike a scan this is a single
+// write-only pass.
+template <typename ExecutionPolicy, typename T>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+auto sequence(ExecutionPolicy&& policy, device_ptr<T> first,
+              device_ptr<T> last, std::type_identity_t<T> init,
+              std::type_identity_t<T> step) {
+  T* out = first.get();
+
+  auto e = policy.get_queue().submit([&](sycl::handler& h) {
+    h.depends_on(policy.get_dependencies());
+
+    h.parallel_for(sycl::range<1>(std::distance(first, last)),
+                   [=](sycl::id<1> i) { out[i] = init + T(i[0]) * step; });
+  });
+
+  return __detail::complete(policy, e);
+}
+
+template <typename ExecutionPolicy, typename T>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+auto sequence(ExecutionPolicy&& policy, device_ptr<T> first,
+              device_ptr<T> last, std::type_identity_t<T> init) {
+  return thrust::sequence(policy, first, last, init, T(1));
+}
+
+template <typename ExecutionPolicy, typename T>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+auto sequence(ExecutionPolicy&& policy, device_ptr<T> first,
+              device_ptr<T> last) {
+  return thrust::sequence(policy, first, last, T{}, T(1));
+}
+
+template <typename T>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+void sequence(device_ptr<T> first, device_ptr<T> last,
+              std::type_identity_t<T> init, std::type_identity_t<T> step) {
+  execution_policy policy(__detail::get_pointer_queue(first.get()));
+  thrust::sequence(policy, first, last, init, step);
+}
+
+template <typename T>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+void sequence(device_ptr<T> first, device_ptr<T> last,
+              std::type_identity_t<T> init) {
+  thrust::sequence(first, last, init, T(1));
+}
+
+template <typename T>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+void sequence(device_ptr<T> first, device_ptr<T> last) {
+  thrust::sequence(first, last, T{}, T(1));
+}
+
+} // namespace thrust
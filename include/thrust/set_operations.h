@@ -0,0 +1,212 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/merge.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Set operations on sorted ranges, which may hold equivalent elements, with
+// the same results as the standard library's.  Each element is first ranked
+// against both ranges by binary search to decide whether it is kept, and a
+// merge-path pass then writes the kept elements in order, so the work per
+// work-item does not depend on how the inputs interleave.  `result` must not
+// overlap the inputs.  Each returns the end of the output, or under
+// `par_nowait` a `future` holding it.
+
+// Elements in either range.  An element with m equivalents in the first
+// range and n in the second appears max(m, n) times: first the m from the
+// first range, then the last n - m from the second.
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto set_union(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1,
+               Iter2 first2, Iter2 last2, device_ptr<U> result, Compare comp) {
+  return __detail::set_operation_impl(
+      policy, first1, std::distance(first1, last1), first2,
+      std::distance(first2, last2), result, comp,
+      [](std::size_t, std::size_t) { return true; },
+      [](std::size_t rank, std::size_t count) { return rank >= count; });
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto set_union(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1,
+               Iter2 first2, Iter2 last2, device_ptr<U> result) {
+  return thrust::set_union(policy, first1, last1, first2, last2, result,
+                           std::less<std::iter_value_t<Iter1>>());
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          typename U, typename Compare>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> set_union(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2,
+                        device_ptr<U> result, Compare comp) {
+  execution_policy policy(__detail::get_iterator_queue(first1));
+  return thrust::set_union(policy, first1, last1, first2, last2, result, comp);
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> set_union(Iter1 first1, Iter1 last1, Iter2 first2, Iter2 last2,
+                        device_ptr<U> result) {
+  return thrust::set_union(first1, last1, first2, last2, result,
+                           std::less<std::iter_value_t<Iter1>>());
+}
+
+// Elements in both ranges, copied from the first.  An element with m
+// equivalents in the first range and n in the second appears min(m, n)
+// times.
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto set_intersection(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1,
+                      Iter2 first2, Iter2 last2, device_ptr<U> result,
+                      Compare comp) {
+  return __detail::set_operation_impl(
+      policy, first1, std::distance(first1, last1), first2,
+      std::distance(first2, last2), result, comp,
+      [](std::size_t rank, std::size_t count) { return rank < count; },
+      __detail::keep_none{});
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto set_intersection(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1,
+                      Iter2 first2, Iter2 last2, device_ptr<U> result) {
+  return thrust::set_intersection(policy, first1, last1, first2, last2, result,
+                                  std::less<std::iter_value_t<Iter1>>());
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          typename U, typename Compare>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> set_intersection(Iter1 first1, Iter1 last1, Iter2 first2,
+                               Iter2 last2, device_ptr<U> result,
+                               Compare comp) {
+  execution_policy policy(__detail::get_iterator_queue(first1));
+  return thrust::set_intersection(policy, first1, last1, first2, last2, result,
+                                  comp);
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> set_intersection(Iter1 first1, Iter1 last1, Iter2 first2,
+                               Iter2 last2, device_ptr<U> result) {
+  return thrust::set_intersection(first1, last1, first2, last2, result,
+                                  std::less<std::iter_value_t<Iter1>>());
+}
+
+// Elements of the first range that are not in the second.  An element with
+// m equivalents in the first range and n in the second appears
+// max(m - n, 0) times.
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto set_difference(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1,
+                    Iter2 first2, Iter2 last2, device_ptr<U> result,
+                    Compare comp) {
+  return __detail::set_operation_impl(
+      policy, first1, std::distance(first1, last1), first2,
+      std::distance(first2, last2), result, comp,
+      [](std::size_t rank, std::size_t count) { return rank >= count; },
+      __detail::keep_none{});
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto set_difference(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1,
+                    Iter2 first2, Iter2 last2, device_ptr<U> result) {
+  return thrust::set_difference(policy, first1, last1, first2, last2, result,
+                                std::less<std::iter_value_t<Iter1>>());
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          typename U, typename Compare>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> set_difference(Iter1 first1, Iter1 last1, Iter2 first2,
+                             Iter2 last2, device_ptr<U> result, Compare comp) {
+  execution_policy policy(__detail::get_iterator_queue(first1));
+  return thrust::set_difference(policy, first1, last1, first2, last2, result,
+                                comp);
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> set_difference(Iter1 first1, Iter1 last1, Iter2 first2,
+                             Iter2 last2, device_ptr<U> result) {
+  return thrust::set_difference(first1, last1, first2, last2, result,
+                                std::less<std::iter_value_t<Iter1>>());
+}
+
+// Elements in exactly one of the ranges.  An element with m equivalents in
+// the first range and n in the second appears |m - n| times, taken from
+// whichever range has more.
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, typename U, typename Compare>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto set_symmetric_difference(ExecutionPolicy&& policy, Iter1 first1,
+                              Iter1 last1, Iter2 first2, Iter2 last2,
+                              device_ptr<U> result, Compare comp) {
+  return __detail::set_operation_impl(
+      policy, first1, std::distance(first1, last1), first2,
+      std::distance(first2, last2), result, comp,
+      [](std::size_t rank, std::size_t count) { return rank >= count; },
+      [](std::size_t rank, std::size_t count) { return rank >= count; });
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto set_symmetric_difference(ExecutionPolicy&& policy, Iter1 first1,
+                              Iter1 last1, Iter2 first2, Iter2 last2,
+                              device_ptr<U> result) {
+  return thrust::set_symmetric_difference(
+      policy, first1, last1, first2, last2, result,
+      std::less<std::iter_value_t<Iter1>>());
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          typename U, typename Compare>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> set_symmetric_difference(Iter1 first1, Iter1 last1, Iter2 first2,
+                                       Iter2 last2, device_ptr<U> result,
+                                       Compare comp) {
+  execution_policy policy(__detail::get_iterator_queue(first1));
+  return thrust::set_symmetric_difference(policy, first1, last1, first2, last2,
+                                          result, comp);
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> set_symmetric_difference(Iter1 first1, Iter1 last1, Iter2 first2,
+                                       Iter2 last2, device_ptr<U> result) {
+  return thrust::set_symmetric_difference(
+      first1, last1, first2, last2, result,
+      std::less<std::iter_value_t<Iter1>>());
+}
+
+} // namespace thrust
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/merge_sort.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/radix_sort.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+
+namespace thrust {
+
+namespace __detail {
+
+// Every sort is stable.  Arithmetic keys compared with `less` or `greater`
+// are radix sorted; anything else goes through the comparison merge sort.
+template <typename ExecutionPolicy, typename T, typename V, typename Compare>
+auto sort_impl(ExecutionPolicy&& policy, T* keys, V* values, std::size_t n,
+               Compare comp) {
+  if (n <= 1) {
+    sycl::event::wait(policy.get_dependencies());
+    return complete(policy, sycl::event());
+  }
+
+  if constexpr (use_radix_sort_v<T, Compare>) {
+    return radix_sort<is_greater_v<Compare, T>>(policy, keys, values, n);
+  } else {
+    return merge_sort(policy, keys, values, n, comp);
+  }
+}
+
+} // namespace __detail
+
+template <typename ExecutionPolicy, typename T, typename Compare>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+auto stable_sort(ExecutionPolicy&& policy, device_ptr<T> first,
+                 device_ptr<T> last, Compare comp) {
+  return __detail::sort_impl(policy, first.get(),
+                             static_cast<__detail::no_value*>(nullptr),
+                             std::distance(first, last), comp);
+}
+
+template <typename ExecutionPolicy, typename T>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+auto stable_sort(ExecutionPolicy&& policy, device_ptr<T> first,
+                 device_ptr<T> last) {
+  return thrust::stable_sort(policy, first, last, std::less<T>());
+}
+
+template <typename T, typename Compare>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+void stable_sort(device_ptr<T> first, device_ptr<T> last, Compare comp) {
+  execution_policy policy(__detail::get_pointer_queue(first.get()));
+  thrust::stable_sort(policy, first, last, comp);
+}
+
+template <typename T>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+void stable_sort(device_ptr<T> first, device_ptr<T> last) {
+  thrust::stable_sort(first, last, std::less<T>());
+}
+
+template <typename ExecutionPolicy, typename T, typename Compare>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+auto sort(ExecutionPolicy&& policy, device_ptr<T> first, device_ptr<T> last,
+          Compare comp) {
+  return thrust::stable_sort(policy, first, last, comp);
+}
+
+template <typename ExecutionPolicy, typename T>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+auto sort(ExecutionPolicy&& policy, device_ptr<T> first, device_ptr<T> last) {
+  return thrust::stable_sort(policy, first, last);
+}
+
+template <typename T, typename Compare>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+void sort(device_ptr<T> first, device_ptr<T> last, Compare comp) {
+  thrust::stable_sort(first, last, comp);
+}
+
+template <typename T>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+void sort(device_ptr<T> first, device_ptr<T> last) {
+  thrust::stable_sort(first, last);
+}
+
+template <typename ExecutionPolicy, typename K, typename V, typename Compare>
+  requires(std::is_trivially_copyable_v<K> && !std::is_const_v<K> &&
+           std::is_trivially_copyable_v<V> && !std::is_const_v<V>)
+auto stable_sort_by_key(ExecutionPolicy&& policy, device_ptr<K> keys_first,
+                        device_ptr<K> keys_last, device_ptr<V> values_first,
+                        Compare comp) {
+  return __detail::sort_impl(policy, keys_first.get(), values_first.get(),
+                             std::distance(keys_first, keys_last), comp);
+}
+
+template <typename ExecutionPolicy, typename K, typename V>
+  requires(std::is_trivially_copyable_v<K> && !std::is_const_v<K> &&
+           std::is_trivially_copyable_v<V> && !std::is_const_v<V>)
+auto stable_sort_by_key(ExecutionPolicy&& policy, device_ptr<K> keys_first,
+                        device_ptr<K> keys_last, device_ptr<V> values_first) {
+  return thrust::stable_sort_by_key(policy, keys_first, keys_last,
+                                    values_first, std::less<K>());
+}
+
+template <typename K, typename V, typename Compare>
+  requires(std::is_trivially_copyable_v<K> && !std::is_const_v<K> &&
+           std::is_trivially_copyable_v<V> && !std::is_const_v<V>)
+void stable_sort_by_key(device_ptr<K> keys_first, device_ptr<K> keys_last,
+                        device_ptr<V> values_first, Compare comp) {
+  execution_policy policy(__detail::get_pointer_queue(keys_first.get()));
+  thrust::stable_sort_by_key(policy, keys_first, keys_last, values_first,
+                             comp);
+}
+
+template <typename K, typename V>
+  requires(std::is_trivially_copyable_v<K> && !std::is_const_v<K> &&
+           std::is_trivially_copyable_v<V> && !std::is_const_v<V>)
+void stable_sort_by_key(device_ptr<K> keys_first, device_ptr<K> keys_last,
+                        device_ptr<V> values_first) {
+  thrust::stable_sort_by_key(keys_first, keys_last, values_first,
+                             std::less<K>());
+}
+
+template <typename ExecutionPolicy, typename K, typename V, typename Compare>
+  requires(std::is_trivially_copyable_v<K> && !std::is_const_v<K> &&
+           std::is_trivially_copyable_v<V> && !std::is_const_v<V>)
+auto sort_by_key(ExecutionPolicy&& policy, device_ptr<K> keys_first,
+                 device_ptr<K> keys_last, device_ptr<V> values_first,
+                 Compare comp) {
+  return thrust::stable_sort_by_key(policy, keys_first, keys_last,
+                                    values_first, comp);
+}
+
+template <typename ExecutionPolicy, typename K, typename V>
+  requires(std::is_trivially_copyable_v<K> && !std::is_const_v<K> &&
+           std::is_trivially_copyable_v<V> && !std::is_const_v<V>)
+auto sort_by_key(ExecutionPolicy&& policy, device_ptr<K> keys_first,
+                 device_ptr<K> keys_last, device_ptr<V> values_first) {
+  return thrust::stable_sort_by_key(policy, keys_first, keys_last,
+                                    values_first);
+}
+
+template <typename K, typename V, typename Compare>
+  requires(std::is_trivially_copyable_v<K> && !std::is_const_v<K> &&
+           std::is_trivially_copyable_v<V> && !std::is_const_v<V>)
+void sort_by_key(device_ptr<K> keys_first, device_ptr<K> keys_last,
+                 device_ptr<V> values_first, Compare comp) {
+  thrust::stable_sort_by_key(keys_first, keys_last, values_first, comp);
+}
+
+template <typename K, typename V>
+  requires(std::is_trivially_copyable_v<K> && !std::is_const_v<K> &&
+           std::is_trivially_copyable_v<V> && !std::is_const_v<V>)
+void sort_by_key(device_ptr<K> keys_first, device_ptr<K> keys_last,
+                 device_ptr<V> values_first) {
+  thrust::stable_sort_by_key(keys_first, keys_last, values_first);
+}
+
+} // namespace thrust
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/get_pointer_device.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/detail/scan.hpp>
+#include <thrust/detail/spmv.hpp>
+#include <thrust/detail/temporary_buffer.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/profiling.h>
+#include <thrust/sort.h>
+
+namespace thrust {
+
+namespace sparse {
+
+// Non-owning view of a CSR matrix held in device memory.  Row r's nonzeros
+// are at positions [row_offsets[r], row_offsets[r + 1]) of `values` and
+// `column_indices`, and nnz is row_offsets[num_rows] - row_offsets[0].
+template <typename T, typename I>
+struct csr_view {
+  device_ptr<T> values;
+  device_ptr<I> row_offsets;
+  device_ptr<I> column_indices;
+  std::size_t num_rows;
+  std::size_t num_cols;
+  std::size_t nnz;
+};
+
+template <typename T, typename TAlloc, typename I, typename IAlloc>
+csr_view<T, I> make_csr_view(std::size_t num_rows, std::size_t num_cols,
+                             device_vector<T, TAlloc>& values,
+                             device_vector<I, IAlloc>& row_offsets,
+                             device_vector<I, IAlloc>& column_indices) {
+  return {values.data(), row_offsets.data(), column_indices.data(),
+          num_rows,      num_cols,           values.size()};
+}
+
+// y = alpha * A * x + beta * y.  Work is split evenly over rows and nonzeros
+// together (a merge-path split), so a few very long rows do not hold up the
+// rest of the matrix.  When beta is zero, y is not read.
+template <typename ExecutionPolicy, typename T, typename I, typename X,
+          typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_integral_v<I> && !std::is_const_v<U>)
+auto spmv(ExecutionPolicy&& policy, const csr_view<T, I>& a, device_ptr<X> x,
+          device_ptr<U> y, U alpha = U(1), U beta = U(0)) {
+  return __detail::spmm_impl(policy, a.values.get(), a.row_offsets.get(),
+                             a.column_indices.get(), a.num_rows, a.nnz, 1,
+                             x.get(), 1, y.get(), 1, alpha, beta);
+}
+
+template <typename T, typename I, typename X, typename U>
+  requires(std::is_integral_v<I> && !std::is_const_v<U>)
+void spmv(const csr_view<T, I>& a, device_ptr<X> x, device_ptr<U> y,
+          U alpha = U(1), U beta = U(0)) {
+  execution_policy policy(__detail::get_pointer_queue(y.get()));
+  thrust::sparse::spmv(policy, a, x, y, alpha, beta);
+}
+
+// C = alpha * A * B + beta * C for k columns, where B (num_cols x k) and
+// C (num_rows x k) are row-major with leading dimensions ldb and ldc.
+template <typename ExecutionPolicy, typename T, typename I, typename X,
+          typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_integral_v<I> && !std::is_const_v<U>)
+auto spmm(ExecutionPolicy&& policy, const csr_view<T, I>& a, std::size_t k,
+          device_ptr<X> b, std::size_t ldb, device_ptr<U> c, std::size_t ldc,
+          U alpha = U(1), U beta = U(0)) {
+  return __detail::spmm_impl(policy, a.values.get(), a.row_offsets.get(),
+                             a.column_indices.get(), a.num_rows, a.nnz, k,
+                             b.get(), ldb, c.get(), ldc, alpha, beta);
+}
+
+template <typename T, typename I, typename X, typename U>
+  requires(std::is_integral_v<I> && !std::is_const_v<U>)
+void spmm(const csr_view<T, I>& a, std::size_t k, device_ptr<X> b,
+          std::size_t ldb, device_ptr<U> c, std::size_t ldc, U alpha = U(1),
+          U beta = U(0)) {
+  execution_policy policy(__detail::get_pointer_queue(c.get()));
+  thrust::sparse::spmm(policy, a, k, b, ldb, c, ldc, alpha, beta);
+}
+
+// Convert a COO matrix, whose entries may be in any order, to CSR with the
+// columns of each row sorted.  The entries are radix sorted by their
+// row-major position (row * num_cols + column, which must fit in 64 bits),
+// gathered into the output arrays, and the row offsets are the exclusive
+// scan of the row lengths.  `offsets_result` receives num_rows + 1 offsets;
+// the outputs must not overlap the inputs.  Duplicate entries are kept.
+template <typename ExecutionPolicy, typename I, typename T, typename J,
+          typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_integral_v<I> && std::is_integral_v<J> &&
+           !std::is_const_v<J> && std::is_trivially_copyable_v<U> &&
+           !std::is_const_v<U>)
+auto coo_to_csr(ExecutionPolicy&& policy, device_ptr<I> rows_first,
+                device_ptr<I> rows_last, device_ptr<I> columns_first,
+                device_ptr<T> values_first, std::size_t num_rows,
+                std::size_t num_cols, device_ptr<J> offsets_result,
+                device_ptr<J> columns_result, device_ptr<U> values_result) {
+  using count_ref =
+      sycl::atomic_ref<std::uint32_t, sycl::memory_order::relaxed,
+                       sycl::memory_scope::device,
+                       sycl::access::address_space::global_space>;
+
+  std::size_t n = std::distance(rows_first, rows_last);
+  const I* rows = rows_first.get();
+  const I* columns = columns_first.get();
+  const T* values = values_first.get();
+  J* offsets_out = offsets_result.get();
+  J* columns_out = columns_result.get();
+  U* values_out = values_result.get();
+
+  sycl::queue& q = policy.get_queue();
+
+  __detail::temporary_buffer<std::uint64_t> keys_buffer(policy, n);
+  __detail::temporary_buffer<std::size_t> order_buffer(policy, n);
+  __detail::temporary_buffer<std::uint32_t> counts_buffer(policy, num_rows);
+  std::uint64_t* keys = keys_buffer.data();
+  std::size_t* order = order_buffer.data();
+  std::uint32_t* counts = counts_buffer.data();
+
+  auto zero_event = q.fill(counts, std::uint32_t(0), num_rows,
+                           policy.get_dependencies());
+
+  auto key_event =
+      __detail::for_each_index(policy.after(zero_event), n, [=](std::size_t i) {
+        std::size_t row = rows[i];
+        keys[i] = std::uint64_t(row) * num_cols + std::size_t(columns[i]);
+        order[i] = i;
+        count_ref(counts[row]).fetch_add(1);
+      });
+
+  // The sort runs under the caller's policy, so its temporaries come from
+  // the same memory and are profiled as part of this call.  Under `par_nowait`
+  // they are held by the event it returns; otherwise it has finished.
+  thrust::event sorted;
+  {
+    __detail::nested_call_scope nested(policy);
+    if constexpr (__detail::is_nowait_policy_v<ExecutionPolicy>) {
+      sorted = __detail::sort_impl(policy.after(key_event), keys, order, n,
+                                   std::less<std::uint64_t>());
+    } else {
+      __detail::sort_impl(policy.after(key_event), keys, order, n,
+                          std::less<std::uint64_t>());
+    }
+  }
+
+  auto gather_event =
+      __detail::for_each_index(policy.after(sorted), n, [=](std::size_t i) {
+        std::size_t k = order[i];
+        columns_out[i] = J(columns[k]);
+        values_out[i] = U(values[k]);
+      });
+
+  auto [e, storage] = __detail::submit_scan(
+      policy.after(gather_event), num_rows + 1,
+      [=](std::size_t r) {
+        return r < num_rows ? std::size_t(counts[r]) : std::size_t(0);
+      },
+      std::plus<std::size_t>(),
+      [=](std::size_t r, const std::size_t&, bool has_prev,
+          const std::size_t& prev) { offsets_out[r] = has_prev ? prev : 0; });
+
+  return __detail::complete(policy, e, std::move(keys_buffer),
+                            std::move(order_buffer), std::move(counts_buffer),
+                            std::move(storage), std::move(sorted));
+}
+
+template <typename I, typename T, typename J, typename U>
+  requires(std::is_integral_v<I> && std::is_integral_v<J> &&
+           !std::is_const_v<J> && std::is_trivially_copyable_v<U> &&
+           !std::is_const_v<U>)
+void coo_to_csr(device_ptr<I> rows_first, device_ptr<I> rows_last,
+                device_ptr<I> columns_first, device_ptr<T> values_first,
+                std::size_t num_rows, std::size_t num_cols,
+                device_ptr<J> offsets_result, device_ptr<J> columns_result,
+                device_ptr<U> values_result) {
+  execution_policy policy(__detail::get_pointer_queue(offsets_result.get()));
+  thrust::sparse::coo_to_csr(policy, rows_first, rows_last, columns_first,
+                             values_first, num_rows, num_cols, offsets_result,
+                             columns_result, values_result);
+}
+
+} // namespace sparse
+
+} // namespace thrust
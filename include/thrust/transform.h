@@ -0,0 +1,156 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/elementwise.hpp>
+#include <thrust/detail/policy_result.hpp>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Arrays of small arithmetic types behind `device_ptr`s are transformed with
+// vector loads and stores; any other iterators are read element by element.
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator OutIter, typename UnaryOp>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto transform(ExecutionPolicy&& policy, Iter first, Iter last,
+               OutIter result, UnaryOp op) {
+  std::size_t n = std::distance(first, last);
+
+  sycl::event e;
+  if constexpr (__detail::is_device_ptr_v<Iter> &&
+                __detail::is_device_ptr_v<OutIter>) {
+    e = __detail::vectorized_transform(policy, n, op, result.get(),
+                                       first.get());
+  } else {
+    e = __detail::for_each_index(policy, n, [=](std::size_t i) {
+      result[i] = op(std::iter_value_t<Iter>(first[i]));
+    });
+  }
+  return __detail::complete(policy, e);
+}
+
+template <__detail::device_iterator Iter, __detail::device_iterator OutIter,
+          typename UnaryOp>
+void transform(Iter first, Iter last, OutIter result, UnaryOp op) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::transform(policy, first, last, result, op);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2, __detail::device_iterator OutIter,
+          typename BinaryOp>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto transform(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1,
+               Iter2 first2, OutIter result, BinaryOp op) {
+  std::size_t n = std::distance(first1, last1);
+
+  sycl::event e;
+  if constexpr (__detail::is_device_ptr_v<Iter1> &&
+                __detail::is_device_ptr_v<Iter2> &&
+                __detail::is_device_ptr_v<OutIter>) {
+    e = __detail::vectorized_transform(policy, n, op, result.get(),
+                                       first1.get(), first2.get());
+  } else {
+    e = __detail::for_each_index(policy, n, [=](std::size_t i) {
+      result[i] = op(std::iter_value_t<Iter1>(first1[i]),
+                     std::iter_value_t<Iter2>(first2[i]));
+    });
+  }
+  return __detail::complete(policy, e);
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          __detail::device_iterator OutIter, typename BinaryOp>
+void transform(Iter1 first1, Iter1 last1, Iter2 first2, OutIter result,
+               BinaryOp op) {
+  execution_policy policy(__detail::get_iterator_queue(first1));
+  thrust::transform(policy, first1, last1, first2, result, op);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator OutIter, typename UnaryOp,
+          typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto transform_if(ExecutionPolicy&& policy, Iter first, Iter last,
+                  OutIter result, UnaryOp op, Predicate pred) {
+  auto e = __detail::for_each_index(
+      policy, std::distance(first, last), [=](std::size_t i) {
+        std::iter_value_t<Iter> value(first[i]);
+        if (pred(value)) {
+          result[i] = op(value);
+        }
+      });
+  return __detail::complete(policy, e);
+}
+
+template <__detail::device_iterator Iter, __detail::device_iterator OutIter,
+          typename UnaryOp, typename Predicate>
+void transform_if(Iter first, Iter last, OutIter result, UnaryOp op,
+                  Predicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::transform_if(policy, first, last, result, op, pred);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter,
+          __detail::device_iterator StencilIter,
+          __detail::device_iterator OutIter, typename UnaryOp,
+          typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto transform_if(ExecutionPolicy&& policy, Iter first, Iter last,
+                  StencilIter stencil, OutIter result, UnaryOp op,
+                  Predicate pred) {
+  auto e = __detail::for_each_index(
+      policy, std::distance(first, last), [=](std::size_t i) {
+        if (pred(std::iter_value_t<StencilIter>(stencil[i]))) {
+          result[i] = op(std::iter_value_t<Iter>(first[i]));
+        }
+      });
+  return __detail::complete(policy, e);
+}
+
+template <__detail::device_iterator Iter,
+          __detail::device_iterator StencilIter,
+          __detail::device_iterator OutIter, typename UnaryOp,
+          typename Predicate>
+void transform_if(Iter first, Iter last, StencilIter stencil, OutIter result,
+                  UnaryOp op, Predicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  thrust::transform_if(policy, first, last, stencil, result, op, pred);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter1,
+          __detail::device_iterator Iter2,
+          __detail::device_iterator StencilIter,
+          __detail::device_iterator OutIter, typename BinaryOp,
+          typename Predicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy>)
+auto transform_if(ExecutionPolicy&& policy, Iter1 first1, Iter1 last1,
+                  Iter2 first2, StencilIter stencil, OutIter result,
+                  BinaryOp op, Predicate pred) {
+  auto e = __detail::for_each_index(
+      policy, std::distance(first1, last1), [=](std::size_t i) {
+        if (pred(std::iter_value_t<StencilIter>(stencil[i]))) {
+          result[i] = op(std::iter_value_t<Iter1>(first1[i]),
+                         std::iter_value_t<Iter2>(first2[i]));
+        }
+      });
+  return __detail::complete(policy, e);
+}
+
+template <__detail::device_iterator Iter1, __detail::device_iterator Iter2,
+          __detail::device_iterator StencilIter,
+          __detail::device_iterator OutIter, typename BinaryOp,
+          typename Predicate>
+void transform_if(Iter1 first1, Iter1 last1, Iter2 first2, StencilIter stencil,
+                  OutIter result, BinaryOp op, Predicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first1));
+  thrust::transform_if(policy, first1, last1, first2, stencil, result, op,
+                       pred);
+}
+
+} // namespace thrust
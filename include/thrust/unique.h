@@ -0,0 +1,97 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include <thrust/detail/compact.hpp>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust {
+
+// Copy the first element of every run of consecutive elements equivalent
+// under `pred` to `result`, and return the end of the output.  Whether an
+// element starts a run is decided inside the scan, which carries the last
+// element of each partial range, so no element is read twice.
+template <typename ExecutionPolicy, __detail::device_iterator Iter, typename U,
+          typename BinaryPredicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto unique_copy(ExecutionPolicy&& policy, Iter first, Iter last,
+                 device_ptr<U> result, BinaryPredicate pred) {
+  using value_type = std::iter_value_t<Iter>;
+  U* out = result.get();
+
+  return __detail::compact_impl(
+      policy, std::distance(first, last),
+      [=](std::size_t i) {
+        value_type value(first[i]);
+        return __detail::run_count<value_type>{1, value, value};
+      },
+      __detail::run_count_op<BinaryPredicate>{pred},
+      [=](std::size_t k, const value_type& value) { out[k] = value; },
+      result);
+}
+
+template <typename ExecutionPolicy, __detail::device_iterator Iter, typename U>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+auto unique_copy(ExecutionPolicy&& policy, Iter first, Iter last,
+                 device_ptr<U> result) {
+  return thrust::unique_copy(policy, first, last, result,
+                             std::equal_to<std::iter_value_t<Iter>>());
+}
+
+template <__detail::device_iterator Iter, typename U,
+          typename BinaryPredicate>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> unique_copy(Iter first, Iter last, device_ptr<U> result,
+                          BinaryPredicate pred) {
+  execution_policy policy(__detail::get_iterator_queue(first));
+  return thrust::unique_copy(policy, first, last, result, pred);
+}
+
+template <__detail::device_iterator Iter, typename U>
+  requires(std::is_trivially_copyable_v<U> && !std::is_const_v<U>)
+device_ptr<U> unique_copy(Iter first, Iter last, device_ptr<U> result) {
+  return thrust::unique_copy(first, last, result,
+                             std::equal_to<std::iter_value_t<Iter>>());
+}
+
+// Remove all but the first element of every run of consecutive equivalent
+// elements and return the new end of the range.
+template <typename ExecutionPolicy, typename T, typename BinaryPredicate>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+auto unique(ExecutionPolicy&& policy, device_ptr<T> first, device_ptr<T> last,
+            BinaryPredicate pred) {
+  return thrust::unique_copy(policy, first, last, first, pred);
+}
+
+template <typename ExecutionPolicy, typename T>
+  requires(__detail::is_execution_policy_v<ExecutionPolicy> &&
+           std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+auto unique(ExecutionPolicy&& policy, device_ptr<T> first,
+            device_ptr<T> last) {
+  return thrust::unique(policy, first, last, std::equal_to<T>());
+}
+
+template <typename T, typename BinaryPredicate>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+device_ptr<T> unique(device_ptr<T> first, device_ptr<T> last,
+                     BinaryPredicate pred) {
+  execution_policy policy(__detail::get_pointer_queue(first.get()));
+  return thrust::unique(policy, first, last, pred);
+}
+
+template <typename T>
+  requires(std::is_trivially_copyable_v<T> && !std::is_const_v<T>)
+device_ptr<T> unique(device_ptr<T> first, device_ptr<T> last) {
+  return thrust::unique(first, last, std::equal_to<T>());
+}
+
+} // namespace thrust
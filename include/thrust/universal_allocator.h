@@ -0,0 +1,84 @@
+#pragma once
+
+#include <sycl/sycl.hpp>
+
+#include <new>
+#include <type_traits>
+
+#include <thrust/detail/default_selector.hpp>
+#include <thrust/detail/get_pointer_device.hpp>
+
+namespace thrust {
+
+// Allocator for shared USM from `sycl::malloc_shared`.  Shared memory can be
+// read and written through plain pointers both on the host and inside
+// kernels, with the runtime migrating pages on demand.  Use `prefetch` and
+// `mem_advise` to move pages ahead of time.
+template <typename T>
+  requires(std::is_trivially_copyable_v<T>)
+class universal_allocator {
+public:
+  using value_type = T;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  template <typename U>
+  universal_allocator(const universal_allocator<U>& other) noexcept
+      : device_(other.get_device()), context_(other.get_context()) {}
+
+  universal_allocator() noexcept
+      : universal_allocator(sycl::queue(thrust::default_selector_v)) {}
+
+  universal_allocator(const sycl::queue& q) noexcept
+      : device_(q.get_device()), context_(q.get_context()) {}
+  universal_allocator(const sycl::context& ctxt,
+                      const sycl::device& dev) noexcept
+      : device_(dev), context_(ctxt) {}
+
+  universal_allocator(const universal_allocator&) = default;
+  universal_allocator& operator=(const universal_allocator&) = default;
+  ~universal_allocator() = default;
+
+  using is_always_equal = std::false_type;
+
+  pointer allocate(std::size_t size) {
+    T* ptr = sycl::malloc_shared<T>(size, device_, context_);
+    if (ptr == nullptr && size > 0) {
+      throw std::bad_alloc();
+    }
+    __detail::pointer_registry::instance().register_allocation(
+        ptr, size * sizeof(T), device_, context_);
+    return ptr;
+  }
+
+  void deallocate(pointer ptr, std::size_t n) {
+    __detail::pointer_registry::instance().unregister_allocation(ptr);
+    sycl::free(ptr, context_);
+  }
+
+  bool operator==(const universal_allocator&) const = default;
+  bool operator!=(const universal_allocator&) const = default;
+
+  template <typename U>
+  struct rebind {
+    using other = universal_allocator<U>;
+  };
+
+  sycl::device get_device() const noexcept {
+    return device_;
+  }
+
+  sycl::context get_context() const noexcept {
+    return context_;
+  }
+
+private:
+  sycl::device device_;
+  sycl::context context_;
+};
+
+} // namespace thrust
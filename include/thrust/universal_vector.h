@@ -0,0 +1,82 @@
+#pragma once
+
+#include <thrust/detail/vector_base.h>
+#include <thrust/device_vector.h>
+#include <thrust/universal_allocator.h>
+
+namespace thrust {
+
+// Vector in shared USM.  `operator[]` is a plain load or store on the host,
+// and `data()` may be used directly inside kernels; wrap it in a `device_ptr`
+// to pass the elements to sycl-thrust algorithms.
+template <typename T, typename Allocator = thrust::universal_allocator<T>>
+  requires(std::is_trivially_copyable_v<T> &&
+           std::is_trivially_destructible_v<T>)
+class universal_vector : public detail::vector_base<T, Allocator> {
+private:
+  using base = detail::vector_base<T, Allocator>;
+
+public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = typename std::allocator_traits<allocator_type>::pointer;
+  using const_pointer =
+      typename std::allocator_traits<allocator_type>::const_pointer;
+  using reference = decltype(*std::declval<pointer>());
+  using const_reference = decltype(*std::declval<const_pointer>());
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+
+  universal_vector() noexcept(noexcept(Allocator())) : base() {}
+
+  explicit universal_vector(const Allocator& allocator) noexcept
+      : base(allocator) {}
+
+  explicit universal_vector(size_type count, const T& value,
+                            const Allocator& alloc = Allocator())
+      : base(count, value, alloc) {}
+
+  explicit universal_vector(size_type count,
+                            const Allocator& alloc = Allocator())
+      : base(count, alloc) {}
+
+  template <std::forward_iterator Iter>
+  constexpr universal_vector(Iter first, Iter last,
+                             const Allocator& alloc = Allocator())
+      : base(first, last, alloc) {}
+
+  template <typename OtherAllocator>
+  constexpr universal_vector(const std::vector<T, OtherAllocator>& other)
+      : base(other) {}
+
+  // Shared memory is allocated for the device that owns `other`.
+  template <typename OtherAllocator>
+  universal_vector(const device_vector<T, OtherAllocator>& other)
+      : base(other.begin(), other.end(),
+             Allocator(other.get_allocator().get_context(),
+                       other.get_allocator().get_device())) {}
+
+  universal_vector(const universal_vector& other) : base(other) {}
+
+  universal_vector(const universal_vector& other, const Allocator& alloc)
+      : base(other, alloc) {}
+
+  universal_vector(universal_vector&& other) noexcept
+    requires(std::is_trivially_move_constructible_v<T>)
+      : base(std::move(other)) {}
+
+  universal_vector(universal_vector&& other, const Allocator& alloc) noexcept
+    requires(std::is_trivially_move_constructible_v<T>)
+      : base(std::move(other), alloc) {}
+
+  universal_vector(std::initializer_list<T> init,
+                   const Allocator& alloc = Allocator())
+      : base(init, alloc) {}
+
+  universal_vector& operator=(const universal_vector& other) = default;
+  universal_vector& operator=(universal_vector&& other) = default;
+};
+
+} // namespace thrust
@@ -0,0 +1,32 @@
+#include <gtest/gtest.h>
+
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+
+#include "util.hpp"
+
+TEST(Async, CopyFillCopyPipeline) {
+  using T = int;
+
+  for (std::size_t n : {3, 45, 823, 1000, 9823, 384241}) {
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    thrust::device_vector<T> d_v(n);
+    std::vector<T> result(n);
+
+    auto policy = thrust::par_nowait;
+
+    thrust::event e1 = thrust::copy(policy, v.begin(), v.end(), d_v.begin());
+    thrust::event e2 =
+        thrust::fill(policy.after(e1), d_v.begin(), d_v.begin() + n / 2, 7);
+    thrust::event e3 = thrust::copy(policy.after(e2), d_v.begin(), d_v.end(),
+                                    result.begin());
+    e3.wait();
+
+    std::fill(v.begin(), v.begin() + n / 2, 7);
+    ASSERT_EQ(v, result);
+  }
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <thrust/binary_search.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+
+#include "util.hpp"
+
+TEST(BinarySearch, Single) {
+  std::vector<int> v(1000);
+  util::fill_random(v.begin(), v.end());
+  std::sort(v.begin(), v.end());
+
+  thrust::device_vector<int> d_v(v);
+  auto first = d_v.begin();
+  auto last = d_v.end();
+
+  for (int value : {-1, 0, 17, 50, 100, 101}) {
+    EXPECT_EQ(thrust::lower_bound(first, last, value) - first,
+              std::lower_bound(v.begin(), v.end(), value) - v.begin());
+    EXPECT_EQ(thrust::upper_bound(thrust::par, first, last, value) - first,
+              std::upper_bound(v.begin(), v.end(), value) - v.begin());
+    EXPECT_EQ(thrust::binary_search(first, last, value),
+              std::binary_search(v.begin(), v.end(), value));
+
+    auto [lower, upper] = thrust::equal_range(first, last, value);
+    auto [expected_lower, expected_upper] =
+        std::equal_range(v.begin(), v.end(), value);
+    EXPECT_EQ(lower - first, expected_lower - v.begin());
+    EXPECT_EQ(upper - first, expected_upper - v.begin());
+  }
+
+  auto future = thrust::lower_bound(thrust::par_nowait, first, last, 50);
+  EXPECT_EQ(future.get() - first,
+            std::lower_bound(v.begin(), v.end(), 50) - v.begin());
+
+  EXPECT_FALSE(thrust::binary_search(first, first, 50));
+  EXPECT_EQ(thrust::upper_bound(first, first, 50), first);
+}
+
+TEST(BinarySearch, Vectorized) {
+  for (std::size_t n : {0, 1, 45, 1000, 98230}) {
+    std::vector<long long> v(n);
+    util::fill_random(v.begin(), v.end());
+    std::sort(v.begin(), v.end(), std::greater<long long>());
+
+    std::vector<long long> values(5000);
+    util::fill_random(values.begin(), values.end());
+    std::reverse(values.begin(), values.end());
+    values[0] = -5;
+    values[1] = 500;
+
+    std::vector<std::size_t> expected_lower(values.size());
+    std::vector<std::size_t> expected_upper(values.size());
+    std::vector<char> expected_found(values.size());
+    for (std::size_t i = 0; i < values.size(); i++) {
+      auto [lower, upper] = std::equal_range(v.begin(), v.end(), values[i],
+                                             std::greater<long long>());
+      expected_lower[i] = lower - v.begin();
+      expected_upper[i] = upper - v.begin();
+      expected_found[i] = lower != upper;
+    }
+
+    thrust::device_vector<long long> d_v(v);
+    thrust::device_vector<long long> d_values(values);
+    thrust::device_vector<std::size_t> d_lower(values.size());
+    thrust::device_vector<std::size_t> d_upper(values.size());
+    thrust::device_vector<char> d_found(values.size());
+
+    auto comp = std::greater<long long>();
+
+    thrust::lower_bound(d_v.begin(), d_v.end(), d_values.begin(),
+                        d_values.end(), d_lower.begin(), comp);
+    EXPECT_TRUE(util::is_equal(expected_lower, d_lower));
+
+    thrust::upper_bound(thrust::par, d_v.begin(), d_v.end(), d_values.begin(),
+                        d_values.end(), d_upper.begin(), comp);
+    EXPECT_TRUE(util::is_equal(expected_upper, d_upper));
+
+    thrust::binary_search(d_v.begin(), d_v.end(), d_values.begin(),
+                          d_values.end(), d_found.begin(), comp);
+    EXPECT_TRUE(util::is_equal(expected_found, d_found));
+
+    thrust::device_vector<std::size_t> d_lower2(values.size());
+    thrust::device_vector<std::size_t> d_upper2(values.size());
+    thrust::equal_range(thrust::par_nowait, d_v.begin(), d_v.end(),
+                        d_values.begin(), d_values.end(), d_lower2.begin(),
+                        d_upper2.begin(), comp)
+        .wait();
+    EXPECT_TRUE(util::is_equal(expected_lower, d_lower2));
+    EXPECT_TRUE(util::is_equal(expected_upper, d_upper2));
+  }
+}
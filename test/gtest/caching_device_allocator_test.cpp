@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <thrust/caching_device_allocator.h>
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+
+#include "util.hpp"
+
+TEST(CachingDeviceAllocator, DeviceVector) {
+  using T = int;
+  using Allocator = thrust::caching_device_allocator<T>;
+
+  for (std::size_t n : {3, 45, 823, 1000, 9823}) {
+    std::vector<T> v(n);
+
+    util::fill_random(v.begin(), v.end());
+
+    thrust::device_vector<T, Allocator> d_v(v);
+    ASSERT_TRUE(util::is_equal(v, d_v));
+
+    thrust::device_vector<T, Allocator> d_v2(d_v);
+    ASSERT_TRUE(util::is_equal(v, d_v2));
+  }
+}
+
+TEST(CachingDeviceAllocator, ReusesBlocks) {
+  using T = float;
+
+  thrust::caching_device_allocator<T> allocator;
+  allocator.release();
+
+  auto before = allocator.stats();
+
+  for (std::size_t i = 0; i < 10; i++) {
+    thrust::device_vector<T, thrust::caching_device_allocator<T>> d_v(
+        1000, allocator);
+  }
+
+  auto after = allocator.stats();
+
+  EXPECT_EQ(after.misses - before.misses, 1);
+  EXPECT_EQ(after.hits - before.hits, 9);
+  EXPECT_EQ(after.bytes_in_use, before.bytes_in_use);
+  EXPECT_GE(after.bytes_cached, 1000 * sizeof(T));
+
+  allocator.release();
+  EXPECT_EQ(allocator.stats().bytes_cached, 0);
+}
+
+TEST(CachingDeviceAllocator, MaxCachedBytes) {
+  using T = char;
+
+  thrust::caching_device_allocator<T> allocator;
+  allocator.release();
+
+  auto max_cached_bytes = allocator.max_cached_bytes();
+  allocator.set_max_cached_bytes(4096);
+
+  auto ptr1 = allocator.allocate(4096);
+  auto ptr2 = allocator.allocate(4096);
+  allocator.deallocate(ptr1, 4096);
+  allocator.deallocate(ptr2, 4096);
+
+  EXPECT_EQ(allocator.stats().bytes_cached, 4096);
+
+  allocator.trim(0);
+  EXPECT_EQ(allocator.stats().bytes_cached, 0);
+
+  allocator.set_max_cached_bytes(max_cached_bytes);
+}
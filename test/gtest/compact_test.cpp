@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/remove.h>
+#include <thrust/unique.h>
+
+#include "util.hpp"
+
+namespace {
+
+std::vector<int> prefix(const thrust::device_vector<int>& d_v,
+                        thrust::device_ptr<const int> last) {
+  std::vector<int> result(last - d_v.begin());
+  thrust::copy(d_v.begin(), last, result.begin());
+  return result;
+}
+
+} // namespace
+
+TEST(CopyIf, Predicate) {
+  auto is_even = [](int x) { return x % 2 == 0; };
+
+  for (std::size_t n : {0, 1, 3, 45, 823, 1000, 9823, 384241}) {
+    std::vector<int> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    std::vector<int> expected;
+    std::copy_if(v.begin(), v.end(), std::back_inserter(expected), is_even);
+
+    thrust::device_vector<int> d_v(v);
+    thrust::device_vector<int> d_result(n);
+
+    auto end = thrust::copy_if(d_v.begin(), d_v.end(), d_result.begin(),
+                               is_even);
+    EXPECT_EQ(prefix(d_result, end), expected);
+  }
+}
+
+TEST(CopyIf, Stencil) {
+  std::size_t n = 9823;
+  std::vector<int> stencil(n);
+  util::fill_random(stencil.begin(), stencil.end());
+
+  std::vector<int> expected;
+  for (std::size_t i = 0; i < n; i++) {
+    if (stencil[i] > 50) {
+      expected.push_back(int(i));
+    }
+  }
+
+  thrust::device_vector<int> d_stencil(stencil);
+  thrust::device_vector<int> d_result(n);
+
+  auto first = thrust::make_counting_iterator(0);
+  auto end =
+      thrust::copy_if(thrust::device, first, first + n, d_stencil.begin(),
+                      d_result.begin(), [](int s) { return s > 50; });
+  EXPECT_EQ(prefix(d_result, end), expected);
+}
+
+TEST(CopyIf, Async) {
+  std::size_t n = 9823;
+  std::vector<int> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  auto is_small = [](int x) { return x < 10; };
+  std::size_t expected = std::count_if(v.begin(), v.end(), is_small);
+
+  thrust::device_vector<int> d_v(v);
+  thrust::device_vector<int> d_result(n);
+
+  auto end = thrust::copy_if(thrust::par_nowait, d_v.begin(), d_v.end(),
+                             d_result.begin(), is_small);
+  EXPECT_EQ(std::size_t(end.get() - d_result.begin()), expected);
+}
+
+TEST(RemoveIf, InPlace) {
+  auto is_odd = [](int x) { return x % 2 == 1; };
+
+  for (std::size_t n : {0, 1, 45, 1000, 9823, 384241}) {
+    std::vector<int> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    thrust::device_vector<int> d_v(v);
+
+    v.erase(std::remove_if(v.begin(), v.end(), is_odd), v.end());
+    auto end = thrust::remove_if(d_v.begin(), d_v.end(), is_odd);
+    EXPECT_EQ(prefix(d_v, end), v);
+  }
+}
+
+TEST(Unique, InPlace) {
+  for (std::size_t n : {0, 1, 45, 1000, 9823, 384241}) {
+    std::vector<int> v(n);
+    util::fill_random(v.begin(), v.end());
+    for (auto&& x : v) {
+      x %= 3;
+    }
+
+    thrust::device_vector<int> d_v(v);
+
+    v.erase(std::unique(v.begin(), v.end()), v.end());
+    auto end = thrust::unique(d_v.begin(), d_v.end());
+    EXPECT_EQ(prefix(d_v, end), v);
+  }
+}
+
+TEST(UniqueCopy, Predicate) {
+  std::size_t n = 9823;
+  std::vector<int> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  auto same_decade = [](int a, int b) { return a / 10 == b / 10; };
+
+  std::vector<int> expected;
+  std::unique_copy(v.begin(), v.end(), std::back_inserter(expected),
+                   same_decade);
+
+  thrust::device_vector<int> d_v(v);
+  thrust::device_vector<int> d_result(n);
+
+  auto end = thrust::unique_copy(d_v.begin(), d_v.end(), d_result.begin(),
+                                 same_decade);
+  EXPECT_EQ(prefix(d_result, end), expected);
+}
+
+TEST(StablePartition, InPlace) {
+  auto is_small = [](int x) { return x < 30; };
+
+  for (std::size_t n : {0, 1, 45, 1000, 9823, 384241}) {
+    std::vector<int> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    thrust::device_vector<int> d_v(v);
+
+    auto middle = std::stable_partition(v.begin(), v.end(), is_small);
+    auto d_middle = thrust::stable_partition(d_v.begin(), d_v.end(), is_small);
+
+    EXPECT_EQ(d_middle - d_v.begin(), middle - v.begin());
+    EXPECT_TRUE(util::is_equal(v, d_v));
+  }
+}
+
+TEST(Partition, Async) {
+  std::size_t n = 9823;
+  std::vector<int> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  auto is_even = [](int x) { return x % 2 == 0; };
+
+  thrust::device_vector<int> d_v(v);
+
+  auto middle = thrust::partition(thrust::par_nowait, d_v.begin(), d_v.end(),
+                                  is_even);
+  std::size_t count = middle.get() - d_v.begin();
+  EXPECT_EQ(count, std::count_if(v.begin(), v.end(), is_even));
+
+  std::vector<int> result(n);
+  thrust::copy(d_v.begin(), d_v.end(), result.begin());
+  EXPECT_TRUE(std::is_partitioned(result.begin(), result.end(), is_even));
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <iterator>
+#include <list>
+#include <ranges>
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+
+#include "util.hpp"
+
+TEST(Copy, NonContiguous) {
+  using T = int;
+
+  // Chunks of 1000 elements, so most ranges take several.
+  auto policy = thrust::par.with_transfer_chunk_size(1000 * sizeof(T));
+  auto nowait_policy =
+      thrust::par_nowait.with_transfer_chunk_size(1000 * sizeof(T));
+
+  for (std::size_t n : {0, 1, 999, 1000, 1001, 9823}) {
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+    std::list<T> l(v.begin(), v.end());
+    std::deque<T> d(v.begin(), v.end());
+
+    thrust::device_vector<T> d_v(n);
+
+    thrust::copy(policy, l.begin(), l.end(), d_v.begin());
+    EXPECT_TRUE(util::is_equal(v, d_v));
+
+    thrust::fill(d_v.begin(), d_v.end(), T(-1));
+    thrust::copy(nowait_policy, d.begin(), d.end(), d_v.begin()).wait();
+    EXPECT_TRUE(util::is_equal(v, d_v));
+
+    // A generator view, read once and converted on the host.
+    auto squares = std::views::iota(std::size_t(0), n) |
+                   std::views::transform([](std::size_t i) { return i * i; });
+    thrust::copy(policy, squares.begin(), squares.end(), d_v.begin());
+    for (std::size_t i = 0; i < n; i++) {
+      EXPECT_EQ(d_v[i], T(i * i));
+    }
+
+    thrust::copy(thrust::par.with_transfer_chunk_size(1), l.begin(), l.end(),
+                 d_v.begin());
+    EXPECT_TRUE(util::is_equal(v, d_v));
+
+    std::list<T> l_result;
+    thrust::copy(policy, d_v.begin(), d_v.end(), std::back_inserter(l_result));
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), l_result.begin(),
+                           l_result.end()));
+
+    std::deque<T> d_result(n);
+    thrust::copy(d_v.begin(), d_v.end(), d_result.begin());
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), d_result.begin(),
+                           d_result.end()));
+  }
+}
+
+TEST(Copy, Chunked) {
+  using T = long long;
+
+  auto policy = thrust::par.with_transfer_chunk_size(4096);
+
+  for (std::size_t n : {511, 512, 513, 98230}) {
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    thrust::device_vector<T> d_v(n);
+    thrust::copy(policy, v.begin(), v.end(), d_v.begin());
+    EXPECT_TRUE(util::is_equal(v, d_v));
+
+    thrust::device_vector<T> d_w(n);
+    thrust::copy(thrust::par_nowait.with_transfer_chunk_size(4096), v.begin(),
+                 v.end(), d_w.begin())
+        .wait();
+    EXPECT_TRUE(util::is_equal(v, d_w));
+
+    std::vector<T> result(n);
+    thrust::copy(policy, d_v.begin(), d_v.end(), result.begin());
+    EXPECT_EQ(result, v);
+
+    std::vector<T> nowait_result(n);
+    thrust::copy(thrust::par_nowait.with_transfer_chunk_size(4096),
+                 d_v.begin(), d_v.end(), nowait_result.begin())
+        .wait();
+    EXPECT_EQ(nowait_result, v);
+  }
+}
+
+TEST(Copy, NowaitChain) {
+  using T = int;
+
+  std::size_t n = 9823;
+  std::vector<T> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  thrust::device_vector<T> d_a(v);
+  thrust::device_vector<T> d_b(n);
+
+  // The upload must not read the host range until the download has filled it.
+  std::vector<T> h(n, -1);
+  auto downloaded =
+      thrust::copy(thrust::par_nowait, d_a.begin(), d_a.end(), h.begin());
+  thrust::copy(thrust::par_nowait.after(downloaded), h.begin(), h.end(),
+               d_b.begin())
+      .wait();
+  EXPECT_TRUE(util::is_equal(v, d_b));
+
+  // Likewise when the upload is streamed a chunk at a time.
+  std::fill(h.begin(), h.end(), -1);
+  thrust::fill(d_b.begin(), d_b.end(), T(-1));
+  downloaded =
+      thrust::copy(thrust::par_nowait, d_a.begin(), d_a.end(), h.begin());
+  thrust::copy(thrust::par_nowait.with_transfer_chunk_size(1000 * sizeof(T))
+                   .after(downloaded),
+               h.begin(), h.end(), d_b.begin())
+      .wait();
+  EXPECT_TRUE(util::is_equal(v, d_b));
+}
@@ -1,9 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <list>
+#include <numeric>
 #include <random>
 #include <ranges>
+#include <thread>
 #include <thrust/copy.h>
 #include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/profiling.h>
 
 #include "util.hpp"
 
@@ -31,6 +36,26 @@ TEST(DeviceVector, Construct) {
   }
 }
 
+TEST(DeviceVector, MoveAssign) {
+  using T = int;
+
+  std::vector<T> v(823);
+  util::fill_random(v.begin(), v.end());
+
+  thrust::device_allocator<T> alloc(sycl::queue(sycl::cpu_selector_v));
+  thrust::device_vector<T> d_v(v.begin(), v.end(), alloc);
+  thrust::device_vector<T> d_w(45, T(1));
+
+  // The storage is adopted together with the allocator that owns it.
+  d_w = std::move(d_v);
+  EXPECT_EQ(d_w.get_allocator(), alloc);
+  EXPECT_TRUE(util::is_equal(v, d_w));
+
+  auto& self = d_w;
+  d_w = std::move(self);
+  EXPECT_TRUE(util::is_equal(v, d_w));
+}
+
 TEST(DeviceVector, Copy) {
   using T = int;
 
@@ -65,3 +90,182 @@ TEST(DeviceVector, Copy) {
     }
   }
 }
+
+TEST(DeviceVector, CopyDeviceToDevice) {
+  using T = int;
+
+  for (std::size_t n : {3, 45, 823, 1000, 9823, 384241}) {
+    std::vector<T> v(n);
+
+    util::fill_random(v.begin(), v.end());
+
+    thrust::device_vector<T> d_v(v);
+
+    thrust::device_vector<T> d_v2(d_v);
+    ASSERT_TRUE(util::is_equal(v, d_v2));
+
+    thrust::device_vector<T> d_v3;
+    d_v3 = d_v;
+    ASSERT_TRUE(util::is_equal(v, d_v3));
+
+    d_v3.reserve(2 * n);
+    ASSERT_TRUE(util::is_equal(v, d_v3));
+
+    // Assignment replaces batched appends along with the old contents.
+    thrust::device_vector<T> d_v6;
+    d_v6.push_back(-1);
+    d_v6 = d_v;
+    ASSERT_TRUE(util::is_equal(v, d_v6));
+
+    thrust::device_vector<T> d_v4(n);
+    thrust::copy(d_v.begin(), d_v.end(), d_v4.begin());
+    ASSERT_TRUE(util::is_equal(v, d_v4));
+
+    thrust::device_vector<T> d_v5(n);
+    thrust::copy(thrust::device, d_v.begin(), d_v.end(), d_v5.begin());
+    ASSERT_TRUE(util::is_equal(v, d_v5));
+  }
+}
+
+TEST(DeviceVector, ConcurrentElementAccess) {
+  using T = int;
+
+  std::size_t n = 64;
+  std::vector<T> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  thrust::device_vector<T> d_v(v);
+
+  std::vector<std::thread> threads;
+  std::vector<int> matches(4, 0);
+
+  for (std::size_t t = 0; t < matches.size(); t++) {
+    threads.emplace_back([&, t] {
+      bool match = true;
+      for (std::size_t i = t; i < n; i += matches.size()) {
+        T value = d_v[i];
+        match = match && value == v[i];
+      }
+      matches[t] = match;
+    });
+  }
+
+  for (auto&& thread : threads) {
+    thread.join();
+  }
+
+  for (int match : matches) {
+    ASSERT_TRUE(match);
+  }
+}
+
+TEST(DeviceVector, PushBack) {
+  using T = int;
+
+  std::size_t n = 1000;
+  std::vector<T> v;
+  thrust::device_vector<T> d_v;
+
+  std::size_t reallocations = 0;
+  {
+    thrust::coalesced_writes scope;
+    for (std::size_t i = 0; i < n; i++) {
+      std::size_t capacity = d_v.capacity();
+      v.push_back(T(i));
+      d_v.push_back(T(i));
+      reallocations += d_v.capacity() != capacity;
+    }
+  }
+
+  EXPECT_LE(reallocations, 11);
+  EXPECT_TRUE(util::is_equal(v, d_v));
+
+  T value = d_v.emplace_back(7);
+  v.emplace_back(7);
+  EXPECT_EQ(value, 7);
+  EXPECT_TRUE(util::is_equal(v, d_v));
+
+  // Appends are batched without a `coalesced_writes` scope too, rather than
+  // written one element at a time.
+  thrust::reset_profiling_counters();
+  thrust::device_vector<T> d_w;
+  for (std::size_t i = 0; i < n; i++) {
+    d_w.push_back(T(i));
+  }
+  d_w.push_back(7);
+  EXPECT_EQ(thrust::get_profiling_counters().device_reference_writes, 0);
+  EXPECT_TRUE(util::is_equal(v, d_w));
+}
+
+TEST(DeviceVector, Insert) {
+  using T = int;
+
+  std::vector<T> v(100);
+  std::iota(v.begin(), v.end(), 0);
+  thrust::device_vector<T> d_v(v);
+  d_v.reserve(1000);
+
+  std::vector<T> a(45, -1);
+  std::list<T> b(50, -2);
+
+  for (std::size_t offset : {0, 10, 145, 245}) {
+    v.insert(v.begin() + offset, a.begin(), a.end());
+    auto pos = d_v.insert(d_v.begin() + offset, a.begin(), a.end());
+    EXPECT_EQ(pos, d_v.begin() + offset);
+    ASSERT_TRUE(util::is_equal(v, d_v));
+
+    v.insert(v.begin() + offset, b.begin(), b.end());
+    d_v.insert(d_v.begin() + offset, b.begin(), b.end());
+    ASSERT_TRUE(util::is_equal(v, d_v));
+  }
+
+  v.insert(v.end(), v.begin(), v.begin() + 10);
+  thrust::device_vector<T> d_head(d_v.begin(), d_v.begin() + 10);
+  d_v.insert(d_v.end(), d_head.begin(), d_head.end());
+  EXPECT_TRUE(util::is_equal(v, d_v));
+}
+
+TEST(DeviceVector, AppendRange) {
+  using T = int;
+
+  std::vector<T> v;
+  thrust::device_vector<T> d_v;
+
+  for (std::size_t i = 0; i < 100; i++) {
+    std::vector<T> batch(i % 7, T(i));
+    v.insert(v.end(), batch.begin(), batch.end());
+    d_v.append_range(batch);
+  }
+  EXPECT_TRUE(util::is_equal(v, d_v));
+
+  auto squares = std::views::iota(0, 10) |
+                 std::views::transform([](int x) { return x * x; });
+  for (int x : squares) {
+    v.push_back(x);
+  }
+  d_v.append_range(squares);
+  EXPECT_TRUE(util::is_equal(v, d_v));
+}
+
+TEST(DeviceVector, ResizeAndShrink) {
+  using T = int;
+
+  thrust::device_vector<T> d_v;
+  std::vector<T> v;
+
+  for (std::size_t n : {10, 11, 12, 30, 5, 50}) {
+    v.resize(n, T(n));
+    d_v.resize(n, T(n));
+    ASSERT_TRUE(util::is_equal(v, d_v));
+  }
+  EXPECT_GT(d_v.capacity(), 50);
+
+  d_v.shrink_to_fit();
+  EXPECT_EQ(d_v.capacity(), 50);
+  EXPECT_TRUE(util::is_equal(v, d_v));
+
+  d_v.resize(0);
+  d_v.shrink_to_fit();
+  EXPECT_EQ(d_v.capacity(), 0);
+  EXPECT_TRUE(d_v.empty());
+}
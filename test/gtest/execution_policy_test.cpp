@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <thrust/caching_device_allocator.h>
+#include <thrust/device_allocator.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+
+#include "util.hpp"
+
+TEST(ExecutionPolicy, Allocator) {
+  using T = int;
+
+  sycl::queue q;
+  thrust::device_allocator<T> allocator(q);
+  auto policy = thrust::par(allocator).on(q);
+
+  for (std::size_t n : {0, 1, 823, 384241}) {
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    thrust::device_vector<T> d_v(v);
+    thrust::device_vector<T> d_result(n);
+
+    EXPECT_EQ(thrust::reduce(policy, d_v.begin(), d_v.end()),
+              std::reduce(v.begin(), v.end()));
+
+    std::vector<T> expected(n);
+    std::inclusive_scan(v.begin(), v.end(), expected.begin());
+    thrust::inclusive_scan(
+        thrust::par_nowait(thrust::caching_device_allocator<T>(q)).on(q),
+        d_v.begin(), d_v.end(), d_result.begin())
+        .wait();
+    EXPECT_TRUE(util::is_equal(expected, d_result));
+  }
+}
+
+TEST(ExecutionPolicy, ScratchArena) {
+  using T = int;
+
+  std::size_t n = 384241;
+  std::vector<T> v(n);
+  util::fill_random(v.begin(), v.end());
+  std::vector<T> sorted(v);
+  std::sort(sorted.begin(), sorted.end());
+
+  auto policy = thrust::par.with_scratch_arena();
+  auto arena = std::dynamic_pointer_cast<thrust::__detail::scratch_arena>(
+      policy.get_temporary_resource());
+  ASSERT_NE(arena, nullptr);
+
+  // The first call grows the arena, and repeated calls fit in it.
+  std::size_t capacity = 0;
+  for (int i = 0; i < 3; i++) {
+    thrust::device_vector<T> d_v(v);
+    EXPECT_EQ(thrust::reduce(policy, d_v.begin(), d_v.end()),
+              std::reduce(v.begin(), v.end()));
+    thrust::sort(policy, d_v.begin(), d_v.end());
+    EXPECT_TRUE(util::is_equal(sorted, d_v));
+
+    if (i == 0) {
+      capacity = arena->capacity();
+      EXPECT_GT(capacity, 0);
+    }
+    EXPECT_EQ(arena->capacity(), capacity);
+  }
+}
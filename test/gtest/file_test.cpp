@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/file.h>
+
+#include "util.hpp"
+
+namespace {
+
+std::filesystem::path temporary_path(const char* name) {
+  return std::filesystem::temp_directory_path() / name;
+}
+
+template <typename T>
+std::vector<T> read_file(const std::filesystem::path& path) {
+  std::vector<T> v(std::filesystem::file_size(path) / sizeof(T));
+  std::ifstream file(path, std::ios::binary);
+  file.read(reinterpret_cast<char*>(v.data()), v.size() * sizeof(T));
+  return v;
+}
+
+} // namespace
+
+TEST(File, Load) {
+  using T = int;
+
+  std::size_t n = 98230;
+  std::vector<T> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  auto path = temporary_path("sycl_thrust_file_load.bin");
+  {
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(v.data()), n * sizeof(T));
+  }
+
+  // Chunks of 1000 elements, so most loads take several.
+  auto policy = thrust::par.with_transfer_chunk_size(1000 * sizeof(T));
+
+  EXPECT_TRUE(util::is_equal(v, thrust::load_file<T>(path)));
+  EXPECT_TRUE(util::is_equal(v, thrust::load_file<T>(policy, path)));
+
+  for (auto [first, count] : {std::pair{0, 0}, std::pair{17, 1},
+                              std::pair{1000, 2000}, std::pair{45, 98000}}) {
+    std::vector<T> expected(v.begin() + first, v.begin() + first + count);
+    EXPECT_TRUE(util::is_equal(
+        expected, thrust::load_file<T>(policy, path, first * sizeof(T),
+                                       std::size_t(count))));
+    EXPECT_TRUE(util::is_equal(
+        expected,
+        thrust::load_file<T>(thrust::par_nowait.with_transfer_chunk_size(64),
+                             path, first * sizeof(T), std::size_t(count))));
+  }
+
+  EXPECT_THROW(thrust::load_file<T>(policy, path, 4, n), std::runtime_error);
+  EXPECT_THROW(thrust::load_file<T>(policy, path, 2), std::runtime_error);
+  EXPECT_THROW(thrust::load_file<T>(temporary_path("sycl_thrust_missing.bin")),
+               std::runtime_error);
+
+  std::filesystem::remove(path);
+}
+
+TEST(File, Store) {
+  using T = long long;
+
+  auto path = temporary_path("sycl_thrust_file_store.bin");
+
+  for (std::size_t n : {0, 1, 511, 512, 513, 98230}) {
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+    thrust::device_vector<T> d_v(v);
+
+    thrust::store_file(thrust::par.with_transfer_chunk_size(4096), path,
+                       d_v.begin(), d_v.end());
+    EXPECT_EQ(read_file<T>(path), v);
+
+    thrust::store_file(path, d_v.begin(), d_v.end());
+    EXPECT_EQ(read_file<T>(path), v);
+    EXPECT_TRUE(util::is_equal(v, thrust::load_file<T>(path)));
+  }
+
+  std::filesystem::remove(path);
+}
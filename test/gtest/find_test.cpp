@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thrust/count.h>
+#include <thrust/device_vector.h>
+#include <thrust/equal.h>
+#include <thrust/execution_policy.h>
+#include <thrust/find.h>
+#include <thrust/logical.h>
+#include <thrust/mismatch.h>
+
+#include "util.hpp"
+
+TEST(Find, FindIf) {
+  std::vector<int> v(98230);
+  util::fill_random(v.begin(), v.end());
+
+  thrust::device_vector<int> d_v(v);
+  auto first = d_v.begin();
+  auto last = d_v.end();
+
+  // Values found near the front, near the back, and not at all.
+  for (int value : {v[3], v[98000], -1}) {
+    auto expected = std::find(v.begin(), v.end(), value) - v.begin();
+    EXPECT_EQ(thrust::find(first, last, value) - first, expected);
+    EXPECT_EQ(thrust::find(thrust::par_nowait, first, last, value).get() -
+                  first,
+              expected);
+  }
+
+  auto is_large = [](int x) { return x > 95; };
+  EXPECT_EQ(thrust::find_if(thrust::par, first, last, is_large) - first,
+            std::find_if(v.begin(), v.end(), is_large) - v.begin());
+  EXPECT_EQ(thrust::find_if_not(first, last, is_large) - first,
+            std::find_if_not(v.begin(), v.end(), is_large) - v.begin());
+  EXPECT_EQ(thrust::find(first, first, v[0]), first);
+}
+
+TEST(Find, LogicalAndCount) {
+  std::vector<int> v(9823);
+  util::fill_random(v.begin(), v.end());
+
+  thrust::device_vector<int> d_v(v);
+  auto first = d_v.begin();
+  auto last = d_v.end();
+
+  for (int threshold : {-1, 50, 100}) {
+    auto below = [=](int x) { return x < threshold; };
+    EXPECT_EQ(thrust::any_of(first, last, below),
+              std::any_of(v.begin(), v.end(), below));
+    EXPECT_EQ(thrust::all_of(thrust::par, first, last, below),
+              std::all_of(v.begin(), v.end(), below));
+    EXPECT_EQ(thrust::none_of(thrust::par_nowait, first, last, below).get(),
+              std::none_of(v.begin(), v.end(), below));
+    EXPECT_EQ(thrust::count_if(first, last, below),
+              std::count_if(v.begin(), v.end(), below));
+  }
+
+  EXPECT_EQ(thrust::count(thrust::par_nowait, first, last, v[0]).get(),
+            std::count(v.begin(), v.end(), v[0]));
+  EXPECT_FALSE(thrust::any_of(first, first, [](int) { return true; }));
+  EXPECT_TRUE(thrust::all_of(first, first, [](int) { return false; }));
+}
+
+TEST(Find, MismatchAndEqual) {
+  // Long enough that host ranges are compared in more than one chunk.
+  std::size_t n = (std::size_t(1) << 20) + 9823;
+  std::vector<int> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  thrust::device_vector<int> d_a(v);
+  thrust::device_vector<int> d_b(v);
+  EXPECT_TRUE(thrust::equal(d_a.begin(), d_a.end(), d_b.begin()));
+  EXPECT_TRUE(thrust::equal(v.begin(), v.end(), d_a.begin()));
+  EXPECT_TRUE(thrust::equal(thrust::par_nowait, d_a.begin(), d_a.end(),
+                            v.begin())
+                  .get());
+
+  for (std::size_t k : {std::size_t(0), std::size_t(4097), n - 1}) {
+    std::vector<int> w = v;
+    w[k] = -1;
+    d_b[k] = -1;
+
+    auto [end_a, end_b] =
+        thrust::mismatch(d_a.begin(), d_a.end(), d_b.begin());
+    EXPECT_EQ(std::size_t(end_a - d_a.begin()), k);
+    EXPECT_EQ(std::size_t(end_b - d_b.begin()), k);
+    EXPECT_EQ(thrust::mismatch(thrust::par_nowait, d_a.begin(), d_a.end(),
+                               d_b.begin())
+                  .get(),
+              k);
+
+    auto [host_end, device_end] =
+        thrust::mismatch(w.begin(), w.end(), d_a.begin());
+    EXPECT_EQ(std::size_t(host_end - w.begin()), k);
+    EXPECT_EQ(std::size_t(device_end - d_a.begin()), k);
+
+    EXPECT_FALSE(thrust::equal(thrust::par, d_a.begin(), d_a.end(),
+                               d_b.begin()));
+    EXPECT_FALSE(thrust::equal(d_a.begin(), d_a.end(), w.begin()));
+    EXPECT_TRUE(thrust::equal(w.begin(), w.end(), d_b.begin()));
+
+    d_b[k] = v[k];
+  }
+}
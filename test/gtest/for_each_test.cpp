@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include "util.hpp"
+
+TEST(ForEach, Modify) {
+  for (std::size_t n : {0, 1, 45, 1000, 9823}) {
+    std::vector<int> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    std::vector<int> expected(v);
+    for (auto&& x : expected) {
+      x *= 2;
+    }
+
+    thrust::device_vector<int> d_v(v);
+    thrust::for_each(d_v.begin(), d_v.end(), [](int& x) { x *= 2; });
+
+    EXPECT_TRUE(util::is_equal(expected, d_v));
+  }
+}
+
+TEST(ForEachN, Scatter) {
+  std::size_t n = 1000;
+  std::vector<int> expected(n);
+  for (std::size_t i = 0; i < n; i++) {
+    expected[n - 1 - i] = int(i);
+  }
+
+  thrust::device_vector<int> d_v(n);
+  int* out = d_v.data().get();
+
+  auto e = thrust::for_each_n(thrust::par_nowait,
+                              thrust::make_counting_iterator(0), n,
+                              [=](int i) { out[n - 1 - i] = i; });
+  e.wait();
+
+  EXPECT_TRUE(util::is_equal(expected, d_v));
+}
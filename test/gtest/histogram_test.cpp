@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/histogram.h>
+
+#include "util.hpp"
+
+namespace {
+
+// Mostly zeros, so that most elements land in the same bin.
+std::vector<int> skewed_values(std::size_t n) {
+  std::vector<int> v(n);
+  util::fill_random(v.begin(), v.end());
+  for (std::size_t i = 0; i < n; i++) {
+    if (i % 10 != 0) {
+      v[i] = 0;
+    }
+  }
+  return v;
+}
+
+} // namespace
+
+TEST(Histogram, EvenBins) {
+  for (std::size_t n : {0, 1, 45, 9823, 100000}) {
+    for (std::size_t num_bins : {1, 7, 64, 10000}) {
+      std::vector<int> v = skewed_values(n);
+
+      std::vector<unsigned int> expected(num_bins);
+      for (int x : v) {
+        if (x >= 0 && x < 90) {
+          expected[std::size_t(x) * num_bins / 90]++;
+        }
+      }
+
+      thrust::device_vector<int> d_v(v);
+      thrust::device_vector<unsigned int> d_counts(num_bins, 5);
+      thrust::histogram(d_v.begin(), d_v.end(), d_counts.begin(), num_bins, 0,
+                        90);
+      EXPECT_TRUE(util::is_equal(expected, d_counts));
+    }
+  }
+}
+
+TEST(Histogram, FullRange) {
+  // Ranges wider than the largest value of the element type.
+  std::vector<int> v = {INT_MIN, INT_MIN + 1, -2, -1, 0, 1, INT_MAX - 1,
+                        INT_MAX};
+  thrust::device_vector<int> d_v(v);
+  thrust::device_vector<unsigned int> d_counts(4);
+  thrust::histogram(d_v.begin(), d_v.end(), d_counts.begin(), 4, INT_MIN,
+                    INT_MAX);
+  std::vector<unsigned int> expected = {2, 2, 2, 1};
+  EXPECT_TRUE(util::is_equal(expected, d_counts));
+
+  std::vector<long long> w = {LLONG_MIN, -1, 0, LLONG_MAX - 1, LLONG_MAX};
+  thrust::device_vector<long long> d_w(w);
+  thrust::histogram(d_w.begin(), d_w.end(), d_counts.begin(), 4, LLONG_MIN,
+                    LLONG_MAX);
+  expected = {1, 1, 1, 1};
+  EXPECT_TRUE(util::is_equal(expected, d_counts));
+}
+
+TEST(Histogram, FloatingPoint) {
+  std::size_t n = 9823;
+  std::vector<double> v(n);
+  for (std::size_t i = 0; i < n; i++) {
+    v[i] = double(i % 100) / 10 - 1;
+  }
+
+  // Bins of width 0.5 over [-1, 9).
+  std::vector<long long> expected(20);
+  for (double x : v) {
+    if (x < 9) {
+      expected[std::size_t((x + 1) * 2)]++;
+    }
+  }
+
+  thrust::device_vector<double> d_v(v);
+  thrust::device_vector<long long> d_counts(20);
+  thrust::histogram(thrust::par_nowait, d_v.begin(), d_v.end(),
+                    d_counts.begin(), 20, -1.0, 9.0)
+      .wait();
+  EXPECT_TRUE(util::is_equal(expected, d_counts));
+}
+
+TEST(Histogram, Edges) {
+  std::vector<int> v = skewed_values(9823);
+  std::vector<int> edges = {-5, 0, 1, 10, 50, 51, 100};
+
+  std::vector<int> expected(edges.size() - 1);
+  for (int x : v) {
+    for (std::size_t b = 0; b + 1 < edges.size(); b++) {
+      if (x >= edges[b] && x < edges[b + 1]) {
+        expected[b]++;
+      }
+    }
+  }
+
+  thrust::device_vector<int> d_v(v);
+  thrust::device_vector<int> d_edges(edges);
+  thrust::device_vector<int> d_counts(expected.size());
+  thrust::histogram(thrust::par, d_v.begin(), d_v.end(), d_edges.begin(),
+                    d_edges.end(), d_counts.begin());
+  EXPECT_TRUE(util::is_equal(expected, d_counts));
+}
+
+TEST(Histogram, MultiColumn) {
+  std::size_t n = 5000;
+  std::size_t ld = 5003;
+  std::size_t num_columns = 3;
+  std::size_t num_bins = 16;
+
+  std::vector<int> v = skewed_values(ld * num_columns);
+  for (std::size_t i = ld; i < 2 * ld; i++) {
+    v[i] = int(i % 64);
+  }
+
+  std::vector<unsigned long long> expected(num_columns * num_bins);
+  for (std::size_t c = 0; c < num_columns; c++) {
+    for (std::size_t i = 0; i < n; i++) {
+      int x = v[c * ld + i];
+      if (x >= 0 && x < 64) {
+        expected[c * num_bins + std::size_t(x) / 4]++;
+      }
+    }
+  }
+
+  thrust::device_vector<int> d_v(v);
+  thrust::device_vector<unsigned long long> d_counts(expected.size());
+  thrust::multi_histogram(d_v.begin(), n, num_columns, ld, d_counts.begin(),
+                          num_bins, 0, 64);
+  EXPECT_TRUE(util::is_equal(expected, d_counts));
+}
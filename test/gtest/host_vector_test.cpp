@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+
+#include "util.hpp"
+
+TEST(HostVector, IsPinned) {
+  thrust::host_vector<int> v(100, 3);
+
+  sycl::context context = v.get_allocator().get_context();
+  EXPECT_EQ(sycl::get_pointer_type(v.data(), context), sycl::usm::alloc::host);
+
+  v.push_back(4);
+  EXPECT_EQ(v.size(), 101);
+  EXPECT_EQ(v[99], 3);
+  EXPECT_EQ(v[100], 4);
+}
+
+TEST(HostVector, RoundTrip) {
+  for (std::size_t n : {0, 1, 45, 1000, 9823}) {
+    std::vector<int> expected(n);
+    util::fill_random(expected.begin(), expected.end());
+
+    thrust::host_vector<int> h_v(expected);
+    thrust::device_vector<int> d_v(h_v.begin(), h_v.end());
+    EXPECT_TRUE(util::is_equal(expected, d_v));
+
+    thrust::host_vector<int> h_result(d_v);
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), h_result.begin(),
+                           h_result.end()));
+  }
+}
+
+TEST(HostVector, AsyncCopy) {
+  std::size_t n = 9823;
+  std::vector<int> expected(n);
+  std::iota(expected.begin(), expected.end(), 0);
+
+  thrust::host_vector<int> h_v(expected);
+  thrust::host_vector<int> h_result(n);
+  thrust::device_vector<int> d_v(n);
+
+  auto policy = thrust::par_nowait;
+
+  auto e1 = thrust::copy(policy, h_v.begin(), h_v.end(), d_v.begin());
+  auto e2 = thrust::copy(policy.after(e1), d_v.begin(), d_v.end(),
+                         h_result.begin());
+  e2.wait();
+
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), h_result.begin(),
+                         h_result.end()));
+}
+
+TEST(HostVector, AsyncCopyPageable) {
+  std::size_t n = 9823;
+  std::vector<int> v(n);
+  util::fill_random(v.begin(), v.end());
+  std::vector<int> expected = v;
+
+  thrust::device_vector<int> d_v(n);
+  std::vector<int> result(n);
+
+  auto policy = thrust::par_nowait;
+
+  // The source is staged, so it may be overwritten once `copy` returns.
+  auto e1 = thrust::copy(policy, v.begin(), v.end(), d_v.begin());
+  std::fill(v.begin(), v.end(), 0);
+
+  auto e2 =
+      thrust::copy(policy.after(e1), d_v.begin(), d_v.end(), result.begin());
+  e2.wait();
+
+  EXPECT_EQ(result, expected);
+}
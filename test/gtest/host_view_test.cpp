@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thrust/device_vector.h>
+#include <thrust/host_view.h>
+
+#include "util.hpp"
+
+TEST(HostView, Read) {
+  for (std::size_t n : {0, 1, 45, 1000, 9823}) {
+    std::vector<int> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    const thrust::device_vector<int> d_v(v);
+
+    auto view = d_v.host_view();
+    std::span<const int> span = view;
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), span.begin(), span.end()));
+  }
+}
+
+TEST(HostView, ReadWrite) {
+  std::size_t n = 1000;
+  std::vector<int> v(n);
+  std::iota(v.begin(), v.end(), 0);
+
+  thrust::device_vector<int> d_v(v);
+
+  {
+    auto view = d_v.host_view(d_v.begin() + 10, d_v.begin() + 20,
+                              thrust::access::read_write);
+    ASSERT_EQ(view.size(), 10);
+    for (auto&& x : view) {
+      x *= 2;
+    }
+  }
+  for (std::size_t i = 10; i < 20; i++) {
+    v[i] *= 2;
+  }
+  EXPECT_TRUE(util::is_equal(v, d_v));
+
+  {
+    auto view = d_v.host_view(d_v.begin(), d_v.end(), thrust::access::read);
+    view[0] = -1;
+  }
+  EXPECT_TRUE(util::is_equal(v, d_v));
+
+  // Views are read-only by default.
+  {
+    auto view = d_v.host_view();
+    view[0] = -1;
+  }
+  EXPECT_TRUE(util::is_equal(v, d_v));
+}
+
+TEST(HostView, Write) {
+  std::size_t n = 1000;
+  std::vector<int> v(n);
+  std::iota(v.begin(), v.end(), 5);
+
+  thrust::device_vector<int> d_v(n);
+
+  {
+    auto view = d_v.host_view(thrust::access::write);
+    std::iota(view.begin(), view.end(), 5);
+    view.flush();
+    EXPECT_TRUE(util::is_equal(v, d_v));
+
+    // The view has not been touched since the flush, so destroying it does
+    // not upload it again over this write.
+    d_v[0] = -1;
+  }
+  v[0] = -1;
+  EXPECT_TRUE(util::is_equal(v, d_v));
+}
+
+TEST(CoalescedWrites, DeviceReference) {
+  std::size_t n = 1000;
+  std::vector<int> v(n);
+  std::iota(v.begin(), v.end(), 0);
+
+  thrust::device_vector<int> d_v(n, -1);
+
+  {
+    thrust::coalesced_writes scope;
+    for (std::size_t i = 0; i < n; i++) {
+      d_v[i] = int(i);
+    }
+
+    // Reads see writes that have not been flushed yet.
+    EXPECT_EQ(int(d_v[n - 1]), int(n - 1));
+
+    d_v[3] = 7;
+    d_v[2] = 9;
+  }
+  v[3] = 7;
+  v[2] = 9;
+
+  EXPECT_TRUE(util::is_equal(v, d_v));
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+
+#include "util.hpp"
+
+TEST(CountingIterator, Arithmetic) {
+  auto first = thrust::make_counting_iterator(10);
+  auto last = first + 5;
+
+  EXPECT_EQ(last - first, 5);
+  EXPECT_EQ(*last, 15);
+  EXPECT_EQ(first[3], 13);
+  EXPECT_TRUE(first < last);
+  EXPECT_EQ(--last, first + 4);
+}
+
+TEST(CountingIterator, Reduce) {
+  for (long long n : {0, 1, 45, 9823}) {
+    auto first = thrust::make_counting_iterator(0ll);
+
+    EXPECT_EQ(thrust::reduce(first, first + n), n * (n - 1) / 2);
+  }
+}
+
+TEST(CountingIterator, Copy) {
+  std::size_t n = 1000;
+  std::vector<int> expected(n);
+  std::iota(expected.begin(), expected.end(), 5);
+
+  auto first = thrust::make_counting_iterator(5);
+
+  thrust::device_vector<int> d_v(n);
+  thrust::copy(first, first + n, d_v.begin());
+  EXPECT_TRUE(util::is_equal(expected, d_v));
+
+  std::vector<int> v(n);
+  thrust::copy(thrust::device, first, first + n, v.begin());
+  EXPECT_EQ(v, expected);
+}
+
+TEST(ConstantIterator, InclusiveScan) {
+  std::size_t n = 9823;
+  std::vector<int> expected(n);
+  std::iota(expected.begin(), expected.end(), 1);
+  std::transform(expected.begin(), expected.end(), expected.begin(),
+                 [](int x) { return 3 * x; });
+
+  auto first = thrust::make_constant_iterator(3);
+
+  thrust::device_vector<int> d_v(n);
+  thrust::inclusive_scan(first, first + n, d_v.begin());
+  EXPECT_TRUE(util::is_equal(expected, d_v));
+}
+
+TEST(TransformIterator, DotProduct) {
+  using T = long long;
+
+  for (std::size_t n : {1, 45, 1000, 9823}) {
+    std::vector<T> a(n);
+    std::vector<T> b(n);
+    util::fill_random(a.begin(), a.end());
+    util::fill_random(b.begin(), b.end());
+    std::reverse(b.begin(), b.end());
+
+    thrust::device_vector<T> d_a(a);
+    thrust::device_vector<T> d_b(b);
+
+    auto mul = [](const std::tuple<T, T>& t) {
+      return std::get<0>(t) * std::get<1>(t);
+    };
+
+    auto zip = thrust::make_zip_iterator(d_a.begin(), d_b.begin());
+    auto first = thrust::make_transform_iterator(zip, mul);
+
+    EXPECT_EQ(thrust::reduce(first, first + n),
+              std::inner_product(a.begin(), a.end(), b.begin(), T(0)));
+  }
+}
+
+TEST(TransformIterator, Counting) {
+  std::size_t n = 1000;
+  std::vector<int> expected(n);
+  for (std::size_t i = 0; i < n; i++) {
+    expected[i] = int(i * i);
+  }
+
+  auto square = [](int x) { return x * x; };
+  auto first = thrust::make_transform_iterator(
+      thrust::make_counting_iterator(0), square);
+
+  std::vector<int> v(n);
+  thrust::copy(first, first + n, v.begin());
+  EXPECT_EQ(v, expected);
+}
+
+TEST(PermutationIterator, Gather) {
+  std::size_t n = 1000;
+  std::vector<int> values(n);
+  util::fill_random(values.begin(), values.end());
+
+  std::vector<int> indices(n);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::reverse(indices.begin(), indices.end());
+
+  std::vector<int> expected(values.rbegin(), values.rend());
+
+  thrust::device_vector<int> d_values(values);
+  thrust::device_vector<int> d_indices(indices);
+  thrust::device_vector<int> d_result(n);
+
+  auto first =
+      thrust::make_permutation_iterator(d_values.begin(), d_indices.begin());
+
+  thrust::copy(first, first + n, d_result.begin());
+  EXPECT_TRUE(util::is_equal(expected, d_result));
+  EXPECT_EQ(thrust::reduce(first, first + n),
+            std::reduce(values.begin(), values.end()));
+}
+
+TEST(ZipIterator, Dereference) {
+  thrust::device_vector<int> d_a(3, 1);
+  thrust::device_vector<float> d_b(3, 2.5f);
+
+  auto zip = thrust::make_zip_iterator(d_a.begin(), d_b.begin());
+
+  std::tuple<int, float> value = zip[2];
+  EXPECT_EQ(value, std::make_tuple(1, 2.5f));
+  EXPECT_EQ((zip + 3) - zip, 3);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/merge.h>
+#include <thrust/set_operations.h>
+
+#include "util.hpp"
+
+namespace {
+
+std::vector<int> sorted_values(std::size_t n, int max_value) {
+  std::vector<int> v(n);
+  util::fill_random(v.begin(), v.end());
+  for (int& x : v) {
+    x %= max_value;
+  }
+  std::sort(v.begin(), v.end());
+  return v;
+}
+
+} // namespace
+
+TEST(Merge, Basic) {
+  // A small delta merged into a large range, and ranges of equal size.
+  for (auto [n1, n2] : {std::pair{0, 0}, std::pair{0, 45}, std::pair{1, 1},
+                        std::pair{98230, 17}, std::pair{9823, 9823}}) {
+    std::vector<int> a = sorted_values(n1, 1000);
+    std::vector<int> b = sorted_values(n2, 50);
+
+    std::vector<int> expected(n1 + n2);
+    std::merge(a.begin(), a.end(), b.begin(), b.end(), expected.begin());
+
+    thrust::device_vector<int> d_a(a);
+    thrust::device_vector<int> d_b(b);
+    thrust::device_vector<int> d_result(n1 + n2);
+
+    auto end = thrust::merge(d_a.begin(), d_a.end(), d_b.begin(), d_b.end(),
+                             d_result.begin());
+    EXPECT_EQ(end, d_result.end());
+    EXPECT_TRUE(util::is_equal(expected, d_result));
+
+    thrust::device_vector<int> d_swapped(n1 + n2);
+    thrust::merge(thrust::par_nowait, d_b.begin(), d_b.end(), d_a.begin(),
+                  d_a.end(), d_swapped.begin())
+        .wait();
+    EXPECT_TRUE(util::is_equal(expected, d_swapped));
+  }
+}
+
+TEST(Merge, ByKey) {
+  std::size_t n1 = 9823;
+  std::size_t n2 = 1000;
+  std::vector<int> keys1 = sorted_values(n1, 100);
+  std::vector<int> keys2 = sorted_values(n2, 100);
+  std::reverse(keys1.begin(), keys1.end());
+  std::reverse(keys2.begin(), keys2.end());
+
+  // Values record which range, and where in it, each key came from, so the
+  // stability of the merge is checked too.
+  std::vector<std::pair<int, int>> pairs;
+  for (std::size_t i = 0; i < n1; i++) {
+    pairs.emplace_back(keys1[i], int(i));
+  }
+  for (std::size_t i = 0; i < n2; i++) {
+    pairs.emplace_back(keys2[i], -1 - int(i));
+  }
+  std::stable_sort(pairs.begin(), pairs.end(), [](auto x, auto y) {
+    return x.first > y.first;
+  });
+
+  std::vector<int> expected_keys;
+  std::vector<int> expected_values;
+  for (auto [key, value] : pairs) {
+    expected_keys.push_back(key);
+    expected_values.push_back(value);
+  }
+
+  std::vector<int> values1(n1);
+  std::vector<int> values2(n2);
+  for (std::size_t i = 0; i < n1; i++) {
+    values1[i] = int(i);
+  }
+  for (std::size_t i = 0; i < n2; i++) {
+    values2[i] = -1 - int(i);
+  }
+
+  thrust::device_vector<int> d_keys1(keys1);
+  thrust::device_vector<int> d_keys2(keys2);
+  thrust::device_vector<int> d_values1(values1);
+  thrust::device_vector<int> d_values2(values2);
+  thrust::device_vector<int> d_keys(n1 + n2);
+  thrust::device_vector<int> d_values(n1 + n2);
+
+  auto [keys_end, values_end] = thrust::merge_by_key(
+      thrust::par, d_keys1.begin(), d_keys1.end(), d_keys2.begin(),
+      d_keys2.end(), d_values1.begin(), d_values2.begin(), d_keys.begin(),
+      d_values.begin(), std::greater<int>());
+  EXPECT_EQ(keys_end, d_keys.end());
+  EXPECT_EQ(values_end, d_values.end());
+  EXPECT_TRUE(util::is_equal(expected_keys, d_keys));
+  EXPECT_TRUE(util::is_equal(expected_values, d_values));
+}
+
+TEST(Merge, SetOperations) {
+  for (auto [n1, n2] : {std::pair{0, 0}, std::pair{45, 0}, std::pair{0, 45},
+                        std::pair{9823, 1000}, std::pair{500, 9823}}) {
+    // Few distinct values, so both ranges hold many duplicates.
+    std::vector<int> a = sorted_values(n1, 40);
+    std::vector<int> b = sorted_values(n2, 60);
+
+    thrust::device_vector<int> d_a(a);
+    thrust::device_vector<int> d_b(b);
+    thrust::device_vector<int> d_result(n1 + n2);
+
+    auto check = [&](auto std_op, auto thrust_op) {
+      std::vector<int> expected(n1 + n2);
+      expected.erase(std_op(a.begin(), a.end(), b.begin(), b.end(),
+                            expected.begin()),
+                     expected.end());
+
+      auto end = thrust_op(d_a.begin(), d_a.end(), d_b.begin(), d_b.end(),
+                           d_result.begin());
+      EXPECT_EQ(std::size_t(end - d_result.begin()), expected.size());
+
+      std::vector<int> result(d_result.size());
+      thrust::copy(d_result.begin(), d_result.end(), result.begin());
+      result.resize(expected.size());
+      EXPECT_EQ(result, expected);
+    };
+
+    check([](auto... args) { return std::set_union(args...); },
+          [](auto... args) { return thrust::set_union(args...); });
+    check([](auto... args) { return std::set_intersection(args...); },
+          [](auto... args) {
+            return thrust::set_intersection(thrust::par, args...);
+          });
+    check([](auto... args) { return std::set_difference(args...); },
+          [](auto... args) { return thrust::set_difference(args...); });
+    check(
+        [](auto... args) { return std::set_symmetric_difference(args...); },
+        [](auto... args) {
+          return thrust::set_symmetric_difference(thrust::par_nowait, args...)
+              .get();
+        });
+  }
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <sstream>
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/equal.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/profiling.h>
+#include <thrust/reduce.h>
+#include <thrust/sparse.h>
+
+#include "util.hpp"
+
+TEST(Profiling, Records) {
+  std::size_t n = 9823;
+  std::vector<int> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  thrust::profiling_policy policy;
+  thrust::device_vector<int> d_v(
+      n, thrust::device_allocator<int>(policy.get_queue()));
+
+  thrust::copy(policy.named("upload"), v.begin(), v.end(), d_v.begin());
+  thrust::fill(policy.named("fill"), d_v.begin(), d_v.begin() + 10, 1);
+  int sum = thrust::reduce(policy.here(), d_v.begin(), d_v.end());
+  thrust::copy(policy.named("download"), d_v.begin(), d_v.end(), v.begin());
+  EXPECT_EQ(sum, std::accumulate(v.begin(), v.end(), 0));
+
+  auto records = policy.records();
+  ASSERT_EQ(records.size(), 4);
+  EXPECT_EQ(records[0].label, "upload");
+  EXPECT_EQ(records[0].host_to_device_bytes, n * sizeof(int));
+  EXPECT_EQ(records[1].label, "fill");
+  EXPECT_NE(records[2].label.find("profiling_test.cpp"), std::string::npos);
+  EXPECT_GT(records[2].allocations, 0);
+  EXPECT_EQ(records[2].device_to_host_bytes, sizeof(int));
+  EXPECT_EQ(records[3].device_to_host_bytes, n * sizeof(int));
+
+  for (auto&& record : records) {
+    EXPECT_LE(record.submit_ns, record.start_ns);
+    EXPECT_LE(record.start_ns, record.end_ns);
+  }
+  for (std::size_t i = 1; i < records.size(); i++) {
+    EXPECT_LE(records[i - 1].end_ns, records[i].start_ns);
+  }
+
+  std::ostringstream trace;
+  policy.write_chrome_trace(trace);
+  EXPECT_NE(trace.str().find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(trace.str().find("\"name\": \"download\""), std::string::npos);
+
+  policy.clear();
+  EXPECT_TRUE(policy.records().empty());
+}
+
+TEST(Profiling, NestedCalls) {
+  // Long enough that the host range is compared in more than one chunk.
+  std::size_t n = (std::size_t(1) << 20) + 9823;
+  std::vector<int> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  thrust::profiling_policy policy;
+  thrust::device_vector<int> d_v(
+      v, thrust::device_allocator<int>(policy.get_queue()));
+
+  EXPECT_TRUE(
+      thrust::equal(policy.named("equal"), v.begin(), v.end(), d_v.begin()));
+  int sum = thrust::reduce(policy.named("reduce"), d_v.begin(), d_v.end());
+  EXPECT_EQ(sum, std::accumulate(v.begin(), v.end(), 0));
+
+  std::size_t nnz = 1000;
+  std::vector<int> rows(nnz);
+  for (std::size_t i = 0; i < nnz; i++) {
+    rows[i] = int((i * 7) % 10);
+  }
+  thrust::device_vector<int> d_rows(rows);
+  thrust::device_vector<int> d_offsets(11);
+  thrust::device_vector<int> d_columns(nnz);
+  thrust::device_vector<int> d_values(nnz);
+  thrust::sparse::coo_to_csr(policy.named("coo_to_csr"), d_rows.data(),
+                             d_rows.data() + nnz, d_rows.data(),
+                             d_rows.data(), 10, 10, d_offsets.data(),
+                             d_columns.data(), d_values.data());
+
+  auto records = policy.records();
+  ASSERT_EQ(records.size(), 3);
+  EXPECT_EQ(records[0].label, "equal");
+  EXPECT_EQ(records[0].host_to_device_bytes, n * sizeof(int));
+  EXPECT_GT(records[0].allocations, 0);
+  EXPECT_GT(records[0].device_to_host_bytes, 0);
+  EXPECT_EQ(records[1].label, "reduce");
+  EXPECT_EQ(records[1].host_to_device_bytes, 0);
+  EXPECT_EQ(records[1].device_to_host_bytes, sizeof(int));
+
+  // Its own keys and order, and the sort's copies of both.
+  EXPECT_EQ(records[2].label, "coo_to_csr");
+  EXPECT_GE(records[2].allocated_bytes,
+            2 * nnz * (sizeof(std::uint64_t) + sizeof(std::size_t)));
+
+  for (std::size_t i = 1; i < records.size(); i++) {
+    EXPECT_LE(records[i - 1].end_ns, records[i].start_ns);
+  }
+}
+
+TEST(Profiling, Counters) {
+  thrust::device_vector<int> d_v(10, 0);
+
+  thrust::reset_profiling_counters();
+  d_v[3] = 7;
+  int x = d_v[3];
+  EXPECT_EQ(x, 7);
+  {
+    thrust::coalesced_writes writes;
+    d_v[4] = 1;
+    d_v[5] = 2;
+  }
+
+  auto counters = thrust::get_profiling_counters();
+  EXPECT_EQ(counters.device_reference_writes, 1);
+  EXPECT_EQ(counters.device_reference_reads, 1);
+  EXPECT_EQ(counters.device_reference_bytes, 2 * sizeof(int));
+}
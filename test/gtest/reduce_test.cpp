@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/reduce.h>
+
+#include "util.hpp"
+
+TEST(Reduce, Sum) {
+  using T = int;
+
+  for (std::size_t n : {0, 1, 3, 45, 823, 1000, 9823, 384241}) {
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    thrust::device_vector<T> d_v(v);
+
+    T expected = std::reduce(v.begin(), v.end());
+
+    EXPECT_EQ(thrust::reduce(d_v.begin(), d_v.end()), expected);
+    EXPECT_EQ(thrust::reduce(thrust::device, d_v.begin(), d_v.end()),
+              expected);
+    EXPECT_EQ(thrust::reduce(d_v.begin(), d_v.end(), T(12)), expected + 12);
+  }
+}
+
+TEST(Reduce, BinaryOp) {
+  using T = int;
+
+  for (std::size_t n : {1, 3, 45, 823, 1000, 9823}) {
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    thrust::device_vector<T> d_v(v);
+
+    auto max = [](T a, T b) { return std::max(a, b); };
+
+    EXPECT_EQ(thrust::reduce(d_v.begin(), d_v.end(), T(-1), max),
+              *std::max_element(v.begin(), v.end()));
+  }
+}
+
+TEST(Reduce, Async) {
+  using T = long long;
+
+  std::size_t n = 9823;
+  std::vector<T> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  thrust::device_vector<T> d_v(v);
+
+  thrust::future<T> sum =
+      thrust::reduce(thrust::par_nowait, d_v.begin(), d_v.end());
+
+  EXPECT_EQ(sum.get(), std::reduce(v.begin(), v.end()));
+}
+
+TEST(TransformReduce, SumOfSquares) {
+  using T = int;
+
+  for (std::size_t n : {0, 1, 3, 45, 823, 1000, 9823, 384241}) {
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    thrust::device_vector<T> d_v(v);
+
+    auto square = [](T x) { return static_cast<long long>(x) * x; };
+
+    long long expected = std::transform_reduce(v.begin(), v.end(), 0ll,
+                                               std::plus<>(), square);
+
+    EXPECT_EQ(thrust::transform_reduce(d_v.begin(), d_v.end(), square, 0ll,
+                                       std::plus<long long>()),
+              expected);
+  }
+}
+
+TEST(ReduceByKey, Sum) {
+  using T = int;
+
+  for (std::size_t n : {0, 1, 3, 45, 823, 1000, 9823, 384241}) {
+    std::vector<int> keys(n);
+    util::fill_random(keys.begin(), keys.end());
+    for (auto&& key : keys) {
+      key %= 3;
+    }
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    std::vector<int> expected_keys;
+    std::vector<T> expected_values;
+    for (std::size_t i = 0; i < n; i++) {
+      if (i == 0 || keys[i] != keys[i - 1]) {
+        expected_keys.push_back(keys[i]);
+        expected_values.push_back(v[i]);
+      } else {
+        expected_values.back() += v[i];
+      }
+    }
+
+    thrust::device_vector<int> d_keys(keys);
+    thrust::device_vector<T> d_v(v);
+    thrust::device_vector<int> d_keys_out(n);
+    thrust::device_vector<T> d_values_out(n);
+
+    auto [keys_end, values_end] =
+        thrust::reduce_by_key(d_keys.begin(), d_keys.end(), d_v.begin(),
+                              d_keys_out.begin(), d_values_out.begin());
+    ASSERT_EQ(keys_end - d_keys_out.begin(), expected_keys.size());
+    ASSERT_EQ(values_end - d_values_out.begin(), expected_values.size());
+
+    d_keys_out.resize(expected_keys.size());
+    d_values_out.resize(expected_values.size());
+    EXPECT_TRUE(util::is_equal(expected_keys, d_keys_out));
+    EXPECT_TRUE(util::is_equal(expected_values, d_values_out));
+  }
+}
+
+TEST(ReduceByKey, Async) {
+  std::size_t n = 9823;
+  std::vector<int> keys(n);
+  for (std::size_t i = 0; i < n; i++) {
+    keys[i] = int(i / 10);
+  }
+
+  thrust::device_vector<int> d_keys(keys);
+  thrust::device_vector<int> d_v(n, 1);
+  thrust::device_vector<int> d_keys_out(n);
+  thrust::device_vector<int> d_values_out(n);
+
+  auto count = thrust::reduce_by_key(
+      thrust::par_nowait, d_keys.begin(), d_keys.end(), d_v.begin(),
+      d_keys_out.begin(), d_values_out.begin(), std::equal_to<int>(),
+      std::plus<int>());
+  ASSERT_EQ(count.get(), 983);
+
+  d_values_out.resize(983);
+  std::vector<int> expected(983, 10);
+  expected.back() = 3;
+  EXPECT_TRUE(util::is_equal(expected, d_values_out));
+}
+
+TEST(SegmentedReduce, Csr) {
+  using T = long long;
+
+  // Rows of very uneven lengths, including empty ones, to cover every
+  // kernel.
+  std::vector<std::size_t> lengths = {0, 1, 8, 9, 0, 100, 512, 513, 3, 5000};
+  for (std::size_t i = 0; i < 1000; i++) {
+    lengths.push_back(i % 17 == 0 ? 700 : i % 5);
+  }
+
+  std::vector<int> offsets = {0};
+  for (std::size_t length : lengths) {
+    offsets.push_back(offsets.back() + int(length));
+  }
+
+  std::vector<T> v(offsets.back());
+  util::fill_random(v.begin(), v.end());
+
+  std::vector<T> expected(lengths.size());
+  for (std::size_t s = 0; s < lengths.size(); s++) {
+    expected[s] = std::reduce(v.begin() + offsets[s],
+                              v.begin() + offsets[s + 1], T(7));
+  }
+
+  thrust::device_vector<T> d_v(v);
+  thrust::device_vector<int> d_offsets(offsets);
+  thrust::device_vector<T> d_result(lengths.size());
+
+  thrust::segmented_reduce(d_v.begin(), d_offsets.begin(), d_offsets.end(),
+                           d_result.begin(), T(7), std::plus<T>());
+  EXPECT_TRUE(util::is_equal(expected, d_result));
+
+  auto max = [](T a, T b) { return std::max(a, b); };
+  for (std::size_t s = 0; s < lengths.size(); s++) {
+    expected[s] = std::reduce(v.begin() + offsets[s],
+                              v.begin() + offsets[s + 1], T(-1), max);
+  }
+
+  thrust::event e = thrust::segmented_reduce(
+      thrust::par_nowait, d_v.begin(), d_offsets.begin(), d_offsets.end(),
+      d_result.begin(), T(-1), max);
+  e.wait();
+  EXPECT_TRUE(util::is_equal(expected, d_result));
+}
@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+
+#include "util.hpp"
+
+namespace {
+
+// Keys made of runs of random length.
+std::vector<int> make_segment_keys(std::size_t n) {
+  std::vector<int> lengths(n);
+  util::fill_random(lengths.begin(), lengths.end());
+
+  std::vector<int> keys(n);
+  int key = 0;
+  for (std::size_t i = 0, run = 0; i < n; i++, run++) {
+    if (run > std::size_t(lengths[i] % 40)) {
+      key++;
+      run = 0;
+    }
+    keys[i] = key;
+  }
+  return keys;
+}
+
+} // namespace
+
+TEST(InclusiveScan, Sum) {
+  using T = int;
+
+  for (std::size_t n : {0, 1, 3, 45, 823, 1000, 9823, 384241}) {
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    std::vector<T> expected(n);
+    std::inclusive_scan(v.begin(), v.end(), expected.begin());
+
+    thrust::device_vector<T> d_v(v);
+    thrust::device_vector<T> d_result(n);
+
+    thrust::inclusive_scan(d_v.begin(), d_v.end(), d_result.begin());
+    EXPECT_TRUE(util::is_equal(expected, d_result));
+
+    // In place.
+    thrust::inclusive_scan(thrust::device, d_v.begin(), d_v.end(),
+                           d_v.begin());
+    EXPECT_TRUE(util::is_equal(expected, d_v));
+  }
+}
+
+TEST(InclusiveScan, BinaryOp) {
+  using T = int;
+
+  for (std::size_t n : {1, 45, 1000, 9823}) {
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    auto max = [](T a, T b) { return std::max(a, b); };
+
+    std::vector<T> expected(n);
+    std::inclusive_scan(v.begin(), v.end(), expected.begin(), max);
+
+    thrust::device_vector<T> d_v(v);
+    thrust::device_vector<T> d_result(n);
+
+    thrust::inclusive_scan(d_v.begin(), d_v.end(), d_result.begin(), max);
+    EXPECT_TRUE(util::is_equal(expected, d_result));
+  }
+}
+
+TEST(ExclusiveScan, Sum) {
+  using T = long long;
+
+  for (std::size_t n : {0, 1, 3, 45, 823, 1000, 9823, 384241}) {
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    std::vector<T> expected(n);
+    std::exclusive_scan(v.begin(), v.end(), expected.begin(), T(0));
+
+    thrust::device_vector<T> d_v(v);
+    thrust::device_vector<T> d_result(n);
+
+    thrust::exclusive_scan(d_v.begin(), d_v.end(), d_result.begin());
+    EXPECT_TRUE(util::is_equal(expected, d_result));
+
+    std::exclusive_scan(v.begin(), v.end(), expected.begin(), T(12));
+
+    thrust::exclusive_scan(thrust::device, d_v.begin(), d_v.end(),
+                           d_v.begin(), T(12));
+    EXPECT_TRUE(util::is_equal(expected, d_v));
+  }
+}
+
+TEST(ExclusiveScan, Async) {
+  using T = int;
+
+  std::size_t n = 9823;
+  std::vector<T> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  std::vector<T> expected(n);
+  std::exclusive_scan(v.begin(), v.end(), expected.begin(), T(3));
+
+  thrust::device_vector<T> d_v(v);
+  thrust::device_vector<T> d_result(n);
+
+  thrust::event e = thrust::exclusive_scan(
+      thrust::par_nowait, d_v.begin(), d_v.end(), d_result.begin(), T(3));
+  e.wait();
+
+  EXPECT_TRUE(util::is_equal(expected, d_result));
+}
+
+TEST(InclusiveScanByKey, Sum) {
+  using T = int;
+
+  for (std::size_t n : {0, 1, 3, 45, 823, 1000, 9823, 384241}) {
+    std::vector<int> keys = make_segment_keys(n);
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    std::vector<T> expected(n);
+    for (std::size_t i = 0; i < n; i++) {
+      bool head = i == 0 || keys[i] != keys[i - 1];
+      expected[i] = head ? v[i] : expected[i - 1] + v[i];
+    }
+
+    thrust::device_vector<int> d_keys(keys);
+    thrust::device_vector<T> d_v(v);
+    thrust::device_vector<T> d_result(n);
+
+    thrust::inclusive_scan_by_key(d_keys.begin(), d_keys.end(), d_v.begin(),
+                                  d_result.begin());
+    EXPECT_TRUE(util::is_equal(expected, d_result));
+  }
+}
+
+TEST(ExclusiveScanByKey, Sum) {
+  using T = int;
+
+  for (std::size_t n : {0, 1, 3, 45, 823, 1000, 9823, 384241}) {
+    std::vector<int> keys = make_segment_keys(n);
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    std::vector<T> expected(n);
+    for (std::size_t i = 0; i < n; i++) {
+      bool head = i == 0 || keys[i] != keys[i - 1];
+      expected[i] = head ? T(5) : expected[i - 1] + v[i - 1];
+    }
+
+    thrust::device_vector<int> d_keys(keys);
+    thrust::device_vector<T> d_v(v);
+
+    // In place.
+    thrust::exclusive_scan_by_key(thrust::device, d_keys.begin(),
+                                  d_keys.end(), d_v.begin(), d_v.begin(),
+                                  T(5));
+    EXPECT_TRUE(util::is_equal(expected, d_v));
+  }
+}
+
+TEST(Sequence, Sequence) {
+  for (std::size_t n : {0, 1, 45, 9823}) {
+    std::vector<int> expected(n);
+    thrust::device_vector<int> d_v(n);
+
+    std::iota(expected.begin(), expected.end(), 0);
+    thrust::sequence(d_v.begin(), d_v.end());
+    EXPECT_TRUE(util::is_equal(expected, d_v));
+
+    std::iota(expected.begin(), expected.end(), 7);
+    thrust::sequence(thrust::device, d_v.begin(), d_v.end(), 7);
+    EXPECT_TRUE(util::is_equal(expected, d_v));
+
+    for (std::size_t i = 0; i < n; i++) {
+      expected[i] = 7 - 3 * int(i);
+    }
+    thrust::sequence(d_v.begin(), d_v.end(), 7, -3);
+    EXPECT_TRUE(util::is_equal(expected, d_v));
+  }
+}
+
+TEST(Sequence, Float) {
+  std::size_t n = 1000;
+  std::vector<float> expected(n);
+  for (std::size_t i = 0; i < n; i++) {
+    expected[i] = 0.5f + float(i) * 0.25f;
+  }
+
+  thrust::device_vector<float> d_v(n);
+  thrust::sequence(d_v.begin(), d_v.end(), 0.5f, 0.25f);
+
+  EXPECT_TRUE(util::is_equal(expected, d_v));
+}
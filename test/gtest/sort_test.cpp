@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sort.h>
+
+#include "util.hpp"
+
+namespace {
+
+template <typename T>
+std::vector<T> random_keys(std::size_t n) {
+  std::mt19937_64 g(n);
+  std::vector<T> v(n);
+  for (auto&& x : v) {
+    if constexpr (std::is_floating_point_v<T>) {
+      x = std::uniform_real_distribution<T>(-1000, 1000)(g);
+    } else {
+      x = static_cast<T>(g());
+    }
+  }
+  // Floating-point zeros of both signs, which compare equal, so a stable
+  // sort must keep them in their original order.
+  if constexpr (std::is_floating_point_v<T>) {
+    for (std::size_t i = 0; i < n; i += 7) {
+      v[i] = i % 2 == 0 ? T(-0.0) : T(0.0);
+    }
+  }
+  return v;
+}
+
+// Equal down to the sign of zero.
+template <typename T>
+bool is_identical(const std::vector<T>& a,
+                  const thrust::device_vector<T>& d_b) {
+  std::vector<T> b(d_b.size());
+  thrust::copy(d_b.begin(), d_b.end(), b.begin());
+  return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](T x, T y) {
+    if constexpr (std::is_floating_point_v<T>) {
+      return x == y && std::signbit(x) == std::signbit(y);
+    } else {
+      return x == y;
+    }
+  });
+}
+
+struct point {
+  int x;
+  int y;
+};
+
+} // namespace
+
+template <typename T>
+class RadixSort : public testing::Test {};
+
+using radix_sort_types =
+    testing::Types<std::int32_t, std::uint32_t, float, double, std::uint64_t,
+                   std::int64_t, std::int8_t, std::uint16_t>;
+TYPED_TEST_SUITE(RadixSort, radix_sort_types);
+
+TYPED_TEST(RadixSort, Sort) {
+  using T = TypeParam;
+
+  for (std::size_t n : {0, 1, 3, 45, 823, 1000, 9823, 100000}) {
+    std::vector<T> v = random_keys<T>(n);
+    thrust::device_vector<T> d_v(v);
+
+    std::stable_sort(v.begin(), v.end());
+    thrust::sort(d_v.begin(), d_v.end());
+
+    ASSERT_TRUE(is_identical(v, d_v));
+  }
+}
+
+TYPED_TEST(RadixSort, SortDescending) {
+  using T = TypeParam;
+
+  for (std::size_t n : {3, 823, 9823}) {
+    std::vector<T> v = random_keys<T>(n);
+    thrust::device_vector<T> d_v(v);
+
+    std::stable_sort(v.begin(), v.end(), std::greater<T>());
+    thrust::sort(thrust::device, d_v.begin(), d_v.end(), std::greater<T>());
+
+    ASSERT_TRUE(is_identical(v, d_v));
+  }
+}
+
+TEST(Sort, SortByKeyIsStable) {
+  for (std::size_t n : {3, 45, 823, 9823, 100000}) {
+    std::vector<std::uint8_t> keys = random_keys<std::uint8_t>(n);
+    std::vector<int> values(n);
+    std::iota(values.begin(), values.end(), 0);
+
+    thrust::device_vector<std::uint8_t> d_keys(keys);
+    thrust::device_vector<int> d_values(values);
+
+    std::stable_sort(values.begin(), values.end(),
+                     [&](int a, int b) { return keys[a] < keys[b]; });
+    std::stable_sort(keys.begin(), keys.end());
+
+    thrust::sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin());
+
+    ASSERT_TRUE(util::is_equal(keys, d_keys));
+    ASSERT_TRUE(util::is_equal(values, d_values));
+  }
+}
+
+TEST(Sort, ComparatorMergeSort) {
+  for (std::size_t n : {1, 3, 45, 823, 1000, 9823}) {
+    std::vector<int> v = random_keys<int>(n);
+    std::vector<point> points(n);
+    std::vector<int> values(n);
+    for (std::size_t i = 0; i < n; i++) {
+      points[i] = point{v[i] % 17, int(i)};
+      values[i] = int(i);
+    }
+
+    thrust::device_vector<point> d_points(points);
+    thrust::device_vector<int> d_values(values);
+
+    auto comp = [](const point& a, const point& b) { return a.x < b.x; };
+
+    std::stable_sort(points.begin(), points.end(), comp);
+    thrust::stable_sort_by_key(d_points.begin(), d_points.end(),
+                               d_values.begin(), comp);
+
+    std::vector<point> result(n);
+    std::vector<int> result_values(n);
+    thrust::copy(d_points.begin(), d_points.end(), result.begin());
+    thrust::copy(d_values.begin(), d_values.end(), result_values.begin());
+
+    for (std::size_t i = 0; i < n; i++) {
+      ASSERT_EQ(points[i].x, result[i].x);
+      ASSERT_EQ(points[i].y, result[i].y);
+      ASSERT_EQ(points[i].y, result_values[i]);
+    }
+  }
+}
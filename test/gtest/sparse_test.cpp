@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sparse.h>
+
+#include "util.hpp"
+
+namespace {
+
+// CSR matrix with power-law row lengths: a few very long rows, many short
+// ones and some empty ones.
+struct host_csr {
+  std::size_t num_rows;
+  std::size_t num_cols;
+  std::vector<int> row_offsets;
+  std::vector<int> column_indices;
+  std::vector<double> values;
+};
+
+host_csr make_power_law_matrix(std::size_t num_rows, std::size_t num_cols) {
+  std::mt19937 g(0);
+  std::uniform_int_distribution<int> column(0, int(num_cols) - 1);
+  std::uniform_int_distribution<int> value(-10, 10);
+
+  host_csr a{num_rows, num_cols, {0}, {}, {}};
+  for (std::size_t r = 0; r < num_rows; r++) {
+    std::size_t length = (r % 7 == 3) ? 0 : 4000 / ((r * 13) % num_rows + 1);
+    for (std::size_t j = 0; j < length; j++) {
+      a.column_indices.push_back(column(g));
+      a.values.push_back(value(g));
+    }
+    a.row_offsets.push_back(int(a.values.size()));
+  }
+  return a;
+}
+
+// C = alpha * A * B + beta * C on the host, with row-major B and C.
+std::vector<double> host_spmm(const host_csr& a, std::size_t k,
+                              const std::vector<double>& b,
+                              std::vector<double> c, double alpha,
+                              double beta) {
+  for (std::size_t r = 0; r < a.num_rows; r++) {
+    for (std::size_t col = 0; col < k; col++) {
+      double sum = 0;
+      for (int j = a.row_offsets[r]; j < a.row_offsets[r + 1]; j++) {
+        sum += a.values[j] * b[a.column_indices[j] * k + col];
+      }
+      c[r * k + col] = alpha * sum + beta * c[r * k + col];
+    }
+  }
+  return c;
+}
+
+} // namespace
+
+TEST(Sparse, Spmv) {
+  for (std::size_t num_rows : {1, 10, 97, 1000}) {
+    host_csr a = make_power_law_matrix(num_rows, 300);
+
+    std::vector<double> x(a.num_cols);
+    std::vector<double> y(a.num_rows);
+    std::iota(x.begin(), x.end(), -100);
+    std::iota(y.begin(), y.end(), 7);
+
+    thrust::device_vector<int> d_row_offsets(a.row_offsets);
+    thrust::device_vector<int> d_column_indices(a.column_indices);
+    thrust::device_vector<double> d_values(a.values);
+    thrust::device_vector<double> d_x(x);
+    thrust::device_vector<double> d_y(y);
+
+    auto d_a = thrust::sparse::make_csr_view(
+        a.num_rows, a.num_cols, d_values, d_row_offsets, d_column_indices);
+
+    thrust::sparse::spmv(d_a, d_x.data(), d_y.data());
+    EXPECT_TRUE(util::is_equal(host_spmm(a, 1, x, y, 1, 0), d_y));
+
+    thrust::device_vector<double> d_z(y);
+    thrust::sparse::spmv(thrust::par, d_a, d_x.data(), d_z.data(), 2.0, -3.0);
+    EXPECT_TRUE(util::is_equal(host_spmm(a, 1, x, y, 2, -3), d_z));
+  }
+}
+
+TEST(Sparse, Spmm) {
+  std::size_t k = 3;
+  host_csr a = make_power_law_matrix(500, 200);
+
+  std::vector<double> b(a.num_cols * k);
+  std::vector<double> c(a.num_rows * k);
+  std::iota(b.begin(), b.end(), -50);
+  std::iota(c.begin(), c.end(), 1);
+
+  thrust::device_vector<int> d_row_offsets(a.row_offsets);
+  thrust::device_vector<int> d_column_indices(a.column_indices);
+  thrust::device_vector<double> d_values(a.values);
+  thrust::device_vector<double> d_b(b);
+  thrust::device_vector<double> d_c(c);
+
+  auto d_a = thrust::sparse::make_csr_view(
+      a.num_rows, a.num_cols, d_values, d_row_offsets, d_column_indices);
+
+  thrust::sparse::spmm(thrust::par_nowait, d_a, k, d_b.data(), k, d_c.data(),
+                       k, 0.5, 2.0)
+      .wait();
+  EXPECT_TRUE(util::is_equal(host_spmm(a, k, b, c, 0.5, 2), d_c));
+}
+
+TEST(Sparse, CooToCsr) {
+  host_csr a = make_power_law_matrix(200, 100);
+
+  // Expand to COO, drop duplicate positions so the column order within each
+  // row is unique, and shuffle the entries.
+  std::vector<std::tuple<int, int, double>> entries;
+  for (std::size_t r = 0; r < a.num_rows; r++) {
+    for (int j = a.row_offsets[r]; j < a.row_offsets[r + 1]; j++) {
+      entries.emplace_back(int(r), a.column_indices[j], a.values[j]);
+    }
+  }
+  std::sort(entries.begin(), entries.end());
+  entries.erase(std::unique(entries.begin(), entries.end(),
+                            [](const auto& x, const auto& y) {
+                              return std::get<0>(x) == std::get<0>(y) &&
+                                     std::get<1>(x) == std::get<1>(y);
+                            }),
+                entries.end());
+
+  std::vector<int> expected_offsets(a.num_rows + 1, 0);
+  std::vector<int> expected_columns;
+  std::vector<double> expected_values;
+  for (auto [r, col, v] : entries) {
+    expected_offsets[r + 1]++;
+    expected_columns.push_back(col);
+    expected_values.push_back(v);
+  }
+  std::partial_sum(expected_offsets.begin(), expected_offsets.end(),
+                   expected_offsets.begin());
+
+  std::shuffle(entries.begin(), entries.end(), std::mt19937(1));
+  std::vector<int> rows;
+  std::vector<int> columns;
+  std::vector<double> values;
+  for (auto [r, col, v] : entries) {
+    rows.push_back(r);
+    columns.push_back(col);
+    values.push_back(v);
+  }
+
+  thrust::device_vector<int> d_rows(rows);
+  thrust::device_vector<int> d_columns(columns);
+  thrust::device_vector<double> d_values(values);
+  thrust::device_vector<int> d_offsets(a.num_rows + 1);
+  thrust::device_vector<int> d_csr_columns(entries.size());
+  thrust::device_vector<double> d_csr_values(entries.size());
+
+  thrust::sparse::coo_to_csr(d_rows.data(), d_rows.data() + rows.size(),
+                             d_columns.data(), d_values.data(), a.num_rows,
+                             a.num_cols, d_offsets.data(),
+                             d_csr_columns.data(), d_csr_values.data());
+
+  EXPECT_TRUE(util::is_equal(expected_offsets, d_offsets));
+  EXPECT_TRUE(util::is_equal(expected_columns, d_csr_columns));
+  EXPECT_TRUE(util::is_equal(expected_values, d_csr_values));
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include "util.hpp"
+
+template <typename T>
+class Transform : public ::testing::Test {};
+
+using TransformTypes = ::testing::Types<char, short, int, float, double>;
+TYPED_TEST_SUITE(Transform, TransformTypes);
+
+TYPED_TEST(Transform, Unary) {
+  using T = TypeParam;
+
+  for (std::size_t n : {0, 1, 3, 45, 823, 1000, 9823}) {
+    std::vector<T> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    auto op = [](T x) { return T(x / 2 + 1); };
+
+    std::vector<T> expected(n);
+    std::transform(v.begin(), v.end(), expected.begin(), op);
+
+    thrust::device_vector<T> d_v(v);
+    thrust::device_vector<T> d_result(n);
+
+    thrust::transform(d_v.begin(), d_v.end(), d_result.begin(), op);
+    EXPECT_TRUE(util::is_equal(expected, d_result));
+
+    // In place.
+    thrust::transform(thrust::device, d_v.begin(), d_v.end(), d_v.begin(), op);
+    EXPECT_TRUE(util::is_equal(expected, d_v));
+  }
+}
+
+TYPED_TEST(Transform, Binary) {
+  using T = TypeParam;
+
+  for (std::size_t n : {0, 1, 3, 45, 823, 1000, 9823}) {
+    std::vector<T> a(n);
+    std::vector<T> b(n);
+    util::fill_random(a.begin(), a.end());
+    util::fill_random(b.begin(), b.end());
+    std::reverse(b.begin(), b.end());
+
+    auto op = [](T x, T y) { return T(x / 2 + y / 2); };
+
+    std::vector<T> expected(n);
+    std::transform(a.begin(), a.end(), b.begin(), expected.begin(), op);
+
+    thrust::device_vector<T> d_a(a);
+    thrust::device_vector<T> d_b(b);
+    thrust::device_vector<T> d_result(n);
+
+    thrust::transform(d_a.begin(), d_a.end(), d_b.begin(), d_result.begin(),
+                      op);
+    EXPECT_TRUE(util::is_equal(expected, d_result));
+  }
+}
+
+TEST(Transform, Unaligned) {
+  std::size_t n = 1000;
+  std::vector<int> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  auto negate = [](int x) { return -x; };
+
+  std::vector<int> expected(n - 1);
+  std::transform(v.begin() + 1, v.end(), expected.begin(), negate);
+
+  thrust::device_vector<int> d_v(v);
+  thrust::device_vector<int> d_result(n - 1);
+
+  thrust::transform(d_v.begin() + 1, d_v.end(), d_result.begin(), negate);
+  EXPECT_TRUE(util::is_equal(expected, d_result));
+}
+
+TEST(Transform, ConvertingOutput) {
+  std::size_t n = 823;
+  std::vector<int> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  auto half = [](int x) { return x / 2.0; };
+
+  std::vector<double> expected(n);
+  std::transform(v.begin(), v.end(), expected.begin(), half);
+
+  thrust::device_vector<int> d_v(v);
+  thrust::device_vector<double> d_result(n);
+
+  thrust::transform(d_v.begin(), d_v.end(), d_result.begin(), half);
+  EXPECT_TRUE(util::is_equal(expected, d_result));
+}
+
+TEST(Transform, FancyInput) {
+  std::size_t n = 1000;
+  std::vector<int> expected(n);
+  for (std::size_t i = 0; i < n; i++) {
+    expected[i] = 3 * int(i);
+  }
+
+  thrust::device_vector<int> d_result(n);
+  auto first = thrust::make_counting_iterator(0);
+
+  thrust::transform(first, first + n, d_result.begin(),
+                    [](int i) { return 3 * i; });
+  EXPECT_TRUE(util::is_equal(expected, d_result));
+}
+
+TEST(TransformIf, Predicate) {
+  std::size_t n = 9823;
+  std::vector<int> v(n);
+  util::fill_random(v.begin(), v.end());
+
+  auto is_even = [](int x) { return x % 2 == 0; };
+  auto square = [](int x) { return x * x; };
+
+  std::vector<int> expected(n, -1);
+  for (std::size_t i = 0; i < n; i++) {
+    if (is_even(v[i])) {
+      expected[i] = square(v[i]);
+    }
+  }
+
+  thrust::device_vector<int> d_v(v);
+  thrust::device_vector<int> d_result(n, -1);
+
+  thrust::transform_if(d_v.begin(), d_v.end(), d_result.begin(), square,
+                       is_even);
+  EXPECT_TRUE(util::is_equal(expected, d_result));
+}
+
+TEST(TransformIf, Stencil) {
+  std::size_t n = 9823;
+  std::vector<int> a(n);
+  std::vector<int> b(n);
+  std::vector<int> stencil(n);
+  util::fill_random(a.begin(), a.end());
+  util::fill_random(b.begin(), b.end());
+  util::fill_random(stencil.begin(), stencil.end());
+  std::reverse(b.begin(), b.end());
+
+  auto is_odd = [](int x) { return x % 2 == 1; };
+
+  std::vector<int> expected_unary(n, 0);
+  std::vector<int> expected_binary(n, 0);
+  for (std::size_t i = 0; i < n; i++) {
+    if (is_odd(stencil[i])) {
+      expected_unary[i] = a[i] + 1;
+      expected_binary[i] = a[i] - b[i];
+    }
+  }
+
+  thrust::device_vector<int> d_a(a);
+  thrust::device_vector<int> d_b(b);
+  thrust::device_vector<int> d_stencil(stencil);
+  thrust::device_vector<int> d_result(n, 0);
+
+  thrust::transform_if(
+      thrust::device, d_a.begin(), d_a.end(), d_stencil.begin(),
+      d_result.begin(), [](int x) { return x + 1; }, is_odd);
+  EXPECT_TRUE(util::is_equal(expected_unary, d_result));
+
+  thrust::fill(d_result.begin(), d_result.end(), 0);
+  thrust::transform_if(
+      d_a.begin(), d_a.end(), d_b.begin(), d_stencil.begin(), d_result.begin(),
+      [](int x, int y) { return x - y; }, is_odd);
+  EXPECT_TRUE(util::is_equal(expected_binary, d_result));
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/prefetch.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
+#include <thrust/universal_vector.h>
+
+#include "util.hpp"
+
+TEST(UniversalVector, IsShared) {
+  thrust::universal_vector<int> v(100, 3);
+
+  sycl::context context = v.get_allocator().get_context();
+  EXPECT_EQ(sycl::get_pointer_type(v.data(), context),
+            sycl::usm::alloc::shared);
+
+  v[10] = 7;
+  EXPECT_EQ(v[10], 7);
+  EXPECT_EQ(std::accumulate(v.begin(), v.end(), 0), 99 * 3 + 7);
+}
+
+TEST(UniversalVector, Algorithms) {
+  for (std::size_t n : {0, 1, 45, 1000, 9823}) {
+    std::vector<int> v(n);
+    util::fill_random(v.begin(), v.end());
+
+    thrust::universal_vector<int> u(v);
+    thrust::prefetch(u.begin(), u.end());
+
+    thrust::device_ptr<int> first(u.data());
+    thrust::transform(first, first + n, first, [](int x) { return 2 * x; });
+    EXPECT_EQ(thrust::reduce(first, first + n),
+              2 * std::reduce(v.begin(), v.end()));
+
+    // Results are read back with plain host loads.
+    for (std::size_t i = 0; i < n; i++) {
+      ASSERT_EQ(u[i], 2 * v[i]);
+    }
+  }
+}
+
+TEST(UniversalVector, DeviceVector) {
+  std::size_t n = 1000;
+  std::vector<int> expected(n);
+  std::iota(expected.begin(), expected.end(), 0);
+
+  thrust::device_vector<int> d_v(expected);
+  thrust::universal_vector<int> u(d_v);
+
+  auto policy = thrust::par_nowait;
+  auto e = thrust::mem_advise(policy, u.begin(), u.end(), 0);
+  e.wait();
+
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), u.begin(), u.end()));
+}
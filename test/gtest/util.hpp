@@ -24,8 +24,7 @@ bool is_equal(const std::vector<T>& a,
     return false;
   }
 
-  std::vector<T> b(d_b.size());
-  thrust::copy(d_b.begin(), d_b.end(), b.begin());
+  auto b = d_b.host_view();
 
   for (std::size_t i = 0; i < a.size(); i++) {
     if (a[i] != b[i]) {